@@ -0,0 +1,65 @@
+#include "bitmap.h"
+
+#include <stdio.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+void bitmap_print(const Bitmap *bitmap, const char *name);
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    Bitmap bitmap = bitmap_create(&arena);
+
+    for (long key = 0; key < 10; key++) {
+        bitmap_insert(&bitmap, key);
+    }
+
+    Bitmap clone = bitmap_clone(&bitmap, nullptr);
+
+    bitmap_remove(&clone, 6);
+    bitmap_insert(&clone, 10);
+
+    bitmap_print(&bitmap, "a");
+    bitmap_print(&clone, "b");
+
+    printf("bitmap.find(6) = %d\n", bitmap_find(&bitmap, 6));
+    printf("clone.find(6) = %d\n", bitmap_find(&clone, 6));
+
+    printf("bitmap.find(10) = %d\n", bitmap_find(&bitmap, 10));
+    printf("clone.find(10) = %d\n", bitmap_find(&clone, 10));
+
+    Bitmap bitmap_or_clone = bitmap_union(&bitmap, &clone, nullptr);
+    bitmap_print(&bitmap_or_clone, "bitmap_or_clone");
+
+    Bitmap bitmap_and_clone = bitmap_intersection(&bitmap, &clone, nullptr);
+    bitmap_print(&bitmap_and_clone, "bitmap_and_clone");
+
+    Bitmap bitmap_minus_clone = bitmap_difference(&bitmap, &clone, nullptr);
+    bitmap_print(&bitmap_minus_clone, "bitmap_minus_clone");
+
+    Bitmap bitmap_xor_clone = bitmap_symmetric_difference(&bitmap, &clone, nullptr);
+    bitmap_print(&bitmap_xor_clone, "bitmap_xor_clone");
+
+    printf("bitmap.is_subset(clone) = %d\n", bitmap_is_subset(&bitmap, &clone));
+    printf("bitmap.is_superset(clone) = %d\n", bitmap_is_superset(&bitmap, &clone));
+
+    Bitmap range = bitmap_create(&arena);
+    for (long key = -100000; key < 100000; key++) {
+        bitmap_insert(&range, key);
+    }
+    bitmap_optimize(&range);
+    printf("range.length = %ld\n", range.length);
+    printf("range.count = %ld\n", range.count);
+
+    arena_destroy(&arena);
+}
+
+void bitmap_print(const Bitmap *bitmap, const char *name) {
+    printf("%s = {", name);
+    auto items = bitmap_items(bitmap, nullptr);
+    for (auto item = items; item < items + bitmap->length; item++) {
+        printf("%ld, ", *item);
+    }
+    printf("}\n");
+}
@@ -0,0 +1,681 @@
+/// @file
+#pragma once
+
+#include <stdbit.h>
+#include <stddef.h>
+
+#include "arena.h"
+
+typedef struct Bitmap Bitmap;
+typedef struct BitmapContainer BitmapContainer;
+
+static constexpr long bitmap_container_bits = 16;  ///< Number of low key bits per container
+static constexpr long bitmap_array_max = 4096;     ///< Maximum length of an array container
+static constexpr long bitmap_words = 1024;         ///< Number of words of a bitset container
+
+/**
+ * @brief Represents the type of a bitmap container
+ */
+typedef enum {
+    BITMAP_ARRAY,   ///< Sorted array of 16-bit values
+    BITMAP_BITSET,  ///< Uncompressed bitset of 2^16 bits
+    BITMAP_RUN,     ///< Sorted array of runs of consecutive values
+} BitmapType;
+
+/**
+ * @brief Represents a compressed bitmap of unique integer keys (Roaring bitmap)
+ *
+ * Keys are split into their high bits, which select a container, and their low 16 bits, which are
+ * stored in the container as a sorted array, a bitset, or a list of runs, whichever is smallest.
+ */
+struct Bitmap {
+    Arena *arena;            ///< Pointer to an arena allocator
+    long length;             ///< Number of keys in the bitmap
+    long count;              ///< Number of containers in the bitmap
+    long capacity;           ///< Number of allocated containers
+    BitmapContainer *begin;  ///< Pointer to the containers, sorted by their key
+};
+
+/**
+ * @brief Represents a single container of a bitmap
+ */
+struct BitmapContainer {
+    uint64_t key;     ///< High bits shared by all values of the container
+    BitmapType type;  ///< Representation of the container data
+    long length;      ///< Number of values in the container
+    long count;       ///< Number of entries in the container data
+    long capacity;    ///< Number of allocated entries
+    void *data;       ///< Pointer to the container data
+};
+
+/**
+ * @brief Create a new bitmap
+ * @param arena Pointer to an arena allocator
+ * @return New bitmap instance
+ */
+static Bitmap bitmap_create(Arena *arena) {
+    Bitmap bitmap = {};
+    bitmap.arena = arena;
+    return bitmap;
+}
+
+/// @private
+static uint64_t x__bitmap_value(long key) {
+    return (uint64_t)key ^ (UINT64_C(1) << 63);
+}
+
+/// @private
+static long x__bitmap_key(uint64_t value) {
+    return (long)(value ^ (UINT64_C(1) << 63));
+}
+
+/// @private
+static long x__bitmap_lower_bound(const uint16_t *values, long count, uint16_t value) {
+    long lower = 0;
+    while (count > 0) {
+        long half = count / 2;
+        if (values[lower + half] < value) {
+            lower += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return lower;
+}
+
+/// @private
+static long x__bitmap_container_index(const Bitmap *self, uint64_t key) {
+    long lower = 0;
+    long count = self->count;
+    while (count > 0) {
+        long half = count / 2;
+        if (self->begin[lower + half].key < key) {
+            lower += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return lower;
+}
+
+/// @private
+static bool x__bitmap_container_find(const BitmapContainer *self, uint16_t value) {
+    const uint16_t *values = self->data;
+    switch (self->type) {
+        case BITMAP_ARRAY: {
+            long index = x__bitmap_lower_bound(values, self->count, value);
+            return index < self->count && values[index] == value;
+        }
+        case BITMAP_BITSET: {
+            const uint64_t *words = self->data;
+            return words[value >> 6] >> (value & 63) & 1;
+        }
+        case BITMAP_RUN: {
+            long lower = 0;
+            long upper = self->count;
+            while (lower < upper) {
+                long middle = (lower + upper) / 2;
+                if (values[2 * middle + 1] < value) {
+                    lower = middle + 1;
+                }
+                else {
+                    upper = middle;
+                }
+            }
+            return lower < self->count && values[2 * lower] <= value;
+        }
+    }
+    return false;
+}
+
+/// @private
+static void x__bitmap_container_words(const BitmapContainer *self, uint64_t *words) {
+    const uint16_t *values = self->data;
+    switch (self->type) {
+        case BITMAP_ARRAY:
+            for (long i = 0; i < self->count; i++) {
+                words[values[i] >> 6] |= UINT64_C(1) << (values[i] & 63);
+            }
+            break;
+        case BITMAP_BITSET:
+            memcpy(words, self->data, bitmap_words * sizeof(uint64_t));
+            break;
+        case BITMAP_RUN:
+            for (long i = 0; i < self->count; i++) {
+                for (long value = values[2 * i]; value <= values[2 * i + 1]; value++) {
+                    words[value >> 6] |= UINT64_C(1) << (value & 63);
+                }
+            }
+            break;
+    }
+}
+
+/// @private
+static long x__bitmap_words_length(const uint64_t *words) {
+    long length = 0;
+    for (long i = 0; i < bitmap_words; i++) {
+        length += stdc_count_ones(words[i]);
+    }
+    return length;
+}
+
+/// @private
+static void x__bitmap_container_from_words(Arena *arena, BitmapContainer *self,
+                                           const uint64_t *words, long length) {
+    self->length = length;
+    if (length <= bitmap_array_max) {
+        uint16_t *values = arena_malloc(arena, length, sizeof(uint16_t), alignof(uint16_t));
+        long count = 0;
+        for (long i = 0; i < bitmap_words; i++) {
+            for (auto word = words[i]; word; word &= word - 1) {
+                values[count++] = 64 * i + stdc_trailing_zeros(word);
+            }
+        }
+        self->type = BITMAP_ARRAY;
+        self->count = length;
+        self->capacity = length;
+        self->data = values;
+    }
+    else {
+        self->type = BITMAP_BITSET;
+        self->count = bitmap_words;
+        self->capacity = bitmap_words;
+        self->data = arena_memdup(arena, words, bitmap_words, sizeof(uint64_t), alignof(uint64_t));
+    }
+}
+
+/// @private
+static void x__bitmap_container_from_values(Arena *arena, BitmapContainer *self,
+                                            const uint16_t *values, long count) {
+    if (count <= bitmap_array_max) {
+        self->type = BITMAP_ARRAY;
+        self->length = count;
+        self->count = count;
+        self->capacity = count;
+        self->data = arena_memdup(arena, values, count, sizeof(uint16_t), alignof(uint16_t));
+    }
+    else {
+        uint64_t words[bitmap_words] = {};
+        for (long i = 0; i < count; i++) {
+            words[values[i] >> 6] |= UINT64_C(1) << (values[i] & 63);
+        }
+        x__bitmap_container_from_words(arena, self, words, count);
+    }
+}
+
+/// @private
+static void x__bitmap_container_expand(Arena *arena, BitmapContainer *self) {
+    if (self->type == BITMAP_RUN) {
+        uint64_t words[bitmap_words] = {};
+        x__bitmap_container_words(self, words);
+        x__bitmap_container_from_words(arena, self, words, self->length);
+    }
+}
+
+/// @private
+static BitmapContainer x__bitmap_container_clone(Arena *arena, const BitmapContainer *self) {
+    BitmapContainer container = *self;
+    long size = self->type == BITMAP_BITSET ? sizeof(uint64_t)
+              : self->type == BITMAP_RUN    ? 2 * sizeof(uint16_t)
+                                            : sizeof(uint16_t);
+    container.capacity = self->count;
+    container.data = arena_memdup(arena, self->data, self->count, size, alignof(uint64_t));
+    return container;
+}
+
+/// @private
+static void x__bitmap_container_append(Bitmap *self, const BitmapContainer *container) {
+    if (self->count == self->capacity) {
+        self->capacity = self->capacity ? 2 * self->capacity : 4;
+        self->begin = arena_realloc(self->arena, self->begin, self->capacity,
+                                    sizeof(BitmapContainer), alignof(BitmapContainer));
+    }
+    self->begin[self->count++] = *container;
+    self->length += container->length;
+}
+
+/**
+ * @brief Insert a new key into a bitmap
+ * @param self Pointer to a bitmap
+ * @param key Key to insert
+ * @return `true` if the key is newly added, or `false` if it already exists
+ */
+static bool bitmap_insert(Bitmap *self, long key) {
+    uint64_t value = x__bitmap_value(key);
+    uint16_t low = value & ((1 << bitmap_container_bits) - 1);
+    long index = x__bitmap_container_index(self, value >> bitmap_container_bits);
+    if (index == self->count || self->begin[index].key != value >> bitmap_container_bits) {
+        BitmapContainer container = {.key = value >> bitmap_container_bits};
+        x__bitmap_container_append(self, &container);
+        memmove(&self->begin[index + 1], &self->begin[index],
+                (self->count - index - 1) * sizeof(BitmapContainer));
+        self->begin[index] = container;
+    }
+    auto container = &self->begin[index];
+    if (x__bitmap_container_find(container, low)) {
+        return false;
+    }
+    x__bitmap_container_expand(self->arena, container);
+    if (container->type == BITMAP_ARRAY) {
+        uint16_t *values = container->data;
+        long position = x__bitmap_lower_bound(values, container->count, low);
+        if (container->count < bitmap_array_max) {
+            if (container->count == container->capacity) {
+                container->capacity = container->capacity ? 2 * container->capacity : 4;
+                values = arena_realloc(self->arena, values, container->capacity, sizeof(uint16_t),
+                                       alignof(uint16_t));
+                container->data = values;
+            }
+            memmove(&values[position + 1], &values[position],
+                    (container->count - position) * sizeof(uint16_t));
+            values[position] = low;
+            container->count += 1;
+            container->length += 1;
+            self->length += 1;
+            return true;
+        }
+        uint64_t *words = arena_calloc(self->arena, bitmap_words, sizeof(uint64_t),
+                                       alignof(uint64_t));
+        x__bitmap_container_words(container, words);
+        container->type = BITMAP_BITSET;
+        container->count = bitmap_words;
+        container->capacity = bitmap_words;
+        container->data = words;
+    }
+    uint64_t *words = container->data;
+    words[low >> 6] |= UINT64_C(1) << (low & 63);
+    container->length += 1;
+    self->length += 1;
+    return true;
+}
+
+/**
+ * @brief Remove a key from a bitmap
+ * @param self Pointer to a bitmap
+ * @param key Key to remove
+ * @return `true` if the key is successfully removed, or `false` if it is not found
+ */
+static bool bitmap_remove(Bitmap *self, long key) {
+    uint64_t value = x__bitmap_value(key);
+    uint16_t low = value & ((1 << bitmap_container_bits) - 1);
+    long index = x__bitmap_container_index(self, value >> bitmap_container_bits);
+    if (index == self->count || self->begin[index].key != value >> bitmap_container_bits) {
+        return false;
+    }
+    auto container = &self->begin[index];
+    if (!x__bitmap_container_find(container, low)) {
+        return false;
+    }
+    x__bitmap_container_expand(self->arena, container);
+    container->length -= 1;
+    self->length -= 1;
+    if (container->type == BITMAP_ARRAY) {
+        uint16_t *values = container->data;
+        long position = x__bitmap_lower_bound(values, container->count, low);
+        memmove(&values[position], &values[position + 1],
+                (container->count - position - 1) * sizeof(uint16_t));
+        container->count -= 1;
+    }
+    else {
+        uint64_t *words = container->data;
+        words[low >> 6] &= ~(UINT64_C(1) << (low & 63));
+        if (container->length == bitmap_array_max) {
+            x__bitmap_container_from_words(self->arena, container, words, container->length);
+        }
+    }
+    if (!container->length) {
+        memmove(&self->begin[index], &self->begin[index + 1],
+                (self->count - index - 1) * sizeof(BitmapContainer));
+        self->count -= 1;
+    }
+    return true;
+}
+
+/**
+ * @brief Find a key of a bitmap
+ * @param self Pointer to a bitmap
+ * @param key Key to find
+ * @return `true` if the key exists, or `false` if it is not found
+ */
+static bool bitmap_find(const Bitmap *self, long key) {
+    uint64_t value = x__bitmap_value(key);
+    long index = x__bitmap_container_index(self, value >> bitmap_container_bits);
+    if (index == self->count || self->begin[index].key != value >> bitmap_container_bits) {
+        return false;
+    }
+    return x__bitmap_container_find(&self->begin[index],
+                                    value & ((1 << bitmap_container_bits) - 1));
+}
+
+/**
+ * @brief Convert containers into runs of consecutive keys where this saves memory
+ * @param self Pointer to a bitmap
+ * @note Containers are converted back to arrays or bitsets when they are modified
+ */
+static void bitmap_optimize(Bitmap *self) {
+    for (auto container = self->begin; container < self->begin + self->count; container++) {
+        if (container->type == BITMAP_RUN) {
+            continue;
+        }
+        uint64_t words[bitmap_words] = {};
+        x__bitmap_container_words(container, words);
+        long count = 0;
+        for (long i = 0; i < bitmap_words; i++) {
+            uint64_t carry = i ? words[i - 1] >> 63 : 0;
+            count += stdc_count_ones(words[i] & ~(words[i] << 1 | carry));
+        }
+        long size = container->type == BITMAP_BITSET ? bitmap_words * sizeof(uint64_t)
+                                                     : container->count * sizeof(uint16_t);
+        if (2 * count * (long)sizeof(uint16_t) >= size) {
+            continue;
+        }
+        uint16_t *values = arena_malloc(self->arena, 2 * count, sizeof(uint16_t),
+                                        alignof(uint64_t));
+        long run = -1;
+        for (long value = 0; value < 1 << bitmap_container_bits; value++) {
+            if (!(words[value >> 6] >> (value & 63) & 1)) {
+                continue;
+            }
+            if (run < 0 || values[2 * run + 1] + 1 != value) {
+                run += 1;
+                values[2 * run] = value;
+            }
+            values[2 * run + 1] = value;
+        }
+        container->type = BITMAP_RUN;
+        container->count = count;
+        container->capacity = count;
+        container->data = values;
+    }
+}
+
+/**
+ * @brief Create a clone of a bitmap
+ * @param self Pointer to a bitmap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Cloned bitmap instance
+ * @note If no arena allocator is passed, the arena allocator of the bitmap is used
+ */
+static Bitmap bitmap_clone(const Bitmap *self, Arena *arena) {
+    Bitmap bitmap = bitmap_create(arena ? arena : self->arena);
+    for (auto container = self->begin; container < self->begin + self->count; container++) {
+        auto clone = x__bitmap_container_clone(bitmap.arena, container);
+        x__bitmap_container_append(&bitmap, &clone);
+    }
+    return bitmap;
+}
+
+/**
+ * @brief Retrieve a sorted array of bitmap keys
+ * @param self Pointer to a bitmap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Pointer to an array of keys
+ * @note If no arena allocator is passed, the arena allocator of the bitmap is used
+ */
+static long *bitmap_items(const Bitmap *self, Arena *arena) {
+    arena = arena ? arena : self->arena;
+    long *items = arena_malloc(arena, self->length, sizeof(long), alignof(long));
+    long index = 0;
+    for (auto container = self->begin; container < self->begin + self->count; container++) {
+        uint64_t high = container->key << bitmap_container_bits;
+        const uint16_t *values = container->data;
+        switch (container->type) {
+            case BITMAP_ARRAY:
+                for (long i = 0; i < container->count; i++) {
+                    items[index++] = x__bitmap_key(high | values[i]);
+                }
+                break;
+            case BITMAP_BITSET: {
+                const uint64_t *words = container->data;
+                for (long i = 0; i < bitmap_words; i++) {
+                    for (auto word = words[i]; word; word &= word - 1) {
+                        items[index++] = x__bitmap_key(high | (64 * i + stdc_trailing_zeros(word)));
+                    }
+                }
+                break;
+            }
+            case BITMAP_RUN:
+                for (long i = 0; i < container->count; i++) {
+                    for (long value = values[2 * i]; value <= values[2 * i + 1]; value++) {
+                        items[index++] = x__bitmap_key(high | value);
+                    }
+                }
+                break;
+        }
+    }
+    return items;
+}
+
+/// @private
+typedef enum {
+    X__BITMAP_UNION,
+    X__BITMAP_INTERSECTION,
+    X__BITMAP_DIFFERENCE,
+    X__BITMAP_SYMMETRIC_DIFFERENCE,
+} X__BitmapOperation;
+
+/// @private
+static long x__bitmap_merge_values(const uint16_t *lhs, long lhs_count, const uint16_t *rhs,
+                                   long rhs_count, uint16_t *values, bool symmetric) {
+    long count = 0;
+    long i = 0;
+    long j = 0;
+    while (i < lhs_count && j < rhs_count) {
+        if (lhs[i] < rhs[j]) {
+            values[count++] = lhs[i++];
+        }
+        else if (rhs[j] < lhs[i]) {
+            values[count++] = rhs[j++];
+        }
+        else {
+            if (!symmetric) {
+                values[count++] = lhs[i];
+            }
+            i += 1;
+            j += 1;
+        }
+    }
+    while (i < lhs_count) {
+        values[count++] = lhs[i++];
+    }
+    while (j < rhs_count) {
+        values[count++] = rhs[j++];
+    }
+    return count;
+}
+
+/// @private
+static BitmapContainer x__bitmap_container_operate(Arena *arena, const BitmapContainer *lhs,
+                                                   const BitmapContainer *rhs,
+                                                   X__BitmapOperation operation) {
+    BitmapContainer container = {.key = lhs->key};
+    if ((operation == X__BITMAP_INTERSECTION &&
+         (lhs->type == BITMAP_ARRAY || rhs->type == BITMAP_ARRAY)) ||
+        (operation == X__BITMAP_DIFFERENCE && lhs->type == BITMAP_ARRAY)) {
+        if (operation == X__BITMAP_INTERSECTION && lhs->type != BITMAP_ARRAY) {
+            auto swap = lhs;
+            lhs = rhs;
+            rhs = swap;
+        }
+        const uint16_t *source = lhs->data;
+        uint16_t values[bitmap_array_max];
+        long count = 0;
+        for (long i = 0; i < lhs->count; i++) {
+            if (x__bitmap_container_find(rhs, source[i]) == (operation == X__BITMAP_INTERSECTION)) {
+                values[count++] = source[i];
+            }
+        }
+        x__bitmap_container_from_values(arena, &container, values, count);
+        return container;
+    }
+    if (operation != X__BITMAP_INTERSECTION && operation != X__BITMAP_DIFFERENCE &&
+        lhs->type == BITMAP_ARRAY && rhs->type == BITMAP_ARRAY) {
+        uint16_t values[2 * bitmap_array_max];
+        long count = x__bitmap_merge_values(lhs->data, lhs->count, rhs->data, rhs->count, values,
+                                            operation == X__BITMAP_SYMMETRIC_DIFFERENCE);
+        x__bitmap_container_from_values(arena, &container, values, count);
+        return container;
+    }
+    uint64_t words[bitmap_words] = {};
+    uint64_t other[bitmap_words] = {};
+    x__bitmap_container_words(lhs, words);
+    x__bitmap_container_words(rhs, other);
+    switch (operation) {
+        case X__BITMAP_UNION:
+            for (long i = 0; i < bitmap_words; i++) {
+                words[i] |= other[i];
+            }
+            break;
+        case X__BITMAP_INTERSECTION:
+            for (long i = 0; i < bitmap_words; i++) {
+                words[i] &= other[i];
+            }
+            break;
+        case X__BITMAP_DIFFERENCE:
+            for (long i = 0; i < bitmap_words; i++) {
+                words[i] &= ~other[i];
+            }
+            break;
+        case X__BITMAP_SYMMETRIC_DIFFERENCE:
+            for (long i = 0; i < bitmap_words; i++) {
+                words[i] ^= other[i];
+            }
+            break;
+    }
+    x__bitmap_container_from_words(arena, &container, words, x__bitmap_words_length(words));
+    return container;
+}
+
+/// @private
+static Bitmap x__bitmap_operate(const Bitmap *self, const Bitmap *other, Arena *arena,
+                                X__BitmapOperation operation) {
+    Bitmap bitmap = bitmap_create(arena ? arena : self->arena);
+    bool keep_self = operation != X__BITMAP_INTERSECTION;
+    bool keep_other = operation == X__BITMAP_UNION || operation == X__BITMAP_SYMMETRIC_DIFFERENCE;
+    auto lhs = self->begin;
+    auto rhs = other->begin;
+    while (lhs < self->begin + self->count || rhs < other->begin + other->count) {
+        BitmapContainer container = {};
+        if (rhs == other->begin + other->count ||
+            (lhs < self->begin + self->count && lhs->key < rhs->key)) {
+            if (keep_self) {
+                container = x__bitmap_container_clone(bitmap.arena, lhs);
+            }
+            lhs += 1;
+        }
+        else if (lhs == self->begin + self->count || rhs->key < lhs->key) {
+            if (keep_other) {
+                container = x__bitmap_container_clone(bitmap.arena, rhs);
+            }
+            rhs += 1;
+        }
+        else {
+            container = x__bitmap_container_operate(bitmap.arena, lhs++, rhs++, operation);
+        }
+        if (container.length) {
+            x__bitmap_container_append(&bitmap, &container);
+        }
+    }
+    return bitmap;
+}
+
+/**
+ * @brief Compute the union of two bitmaps
+ * @param self Pointer to a bitmap
+ * @param other Pointer to another bitmap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return New bitmap containing all unique keys from both bitmaps
+ */
+static Bitmap bitmap_union(const Bitmap *self, const Bitmap *other, Arena *arena) {
+    return x__bitmap_operate(self, other, arena, X__BITMAP_UNION);
+}
+
+/**
+ * @brief Compute the intersection of two bitmaps
+ * @param self Pointer to a bitmap
+ * @param other Pointer to another bitmap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return New bitmap containing keys common to both bitmaps
+ */
+static Bitmap bitmap_intersection(const Bitmap *self, const Bitmap *other, Arena *arena) {
+    return x__bitmap_operate(self, other, arena, X__BITMAP_INTERSECTION);
+}
+
+/**
+ * @brief Compute the difference of two bitmaps
+ * @param self Pointer to a bitmap
+ * @param other Pointer to another bitmap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return New bitmap containing keys in the first bitmap but not in the second
+ */
+static Bitmap bitmap_difference(const Bitmap *self, const Bitmap *other, Arena *arena) {
+    return x__bitmap_operate(self, other, arena, X__BITMAP_DIFFERENCE);
+}
+
+/**
+ * @brief Compute the symmetric difference of two bitmaps
+ * @param self Pointer to a bitmap
+ * @param other Pointer to another bitmap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return New bitmap containing keys that are in either of the bitmaps but not in both
+ */
+static Bitmap bitmap_symmetric_difference(const Bitmap *self, const Bitmap *other, Arena *arena) {
+    return x__bitmap_operate(self, other, arena, X__BITMAP_SYMMETRIC_DIFFERENCE);
+}
+
+/**
+ * @brief Check if one bitmap is a subset of another
+ * @param self Pointer to a bitmap
+ * @param other Pointer to another bitmap
+ * @return `true` if all keys in the first bitmap are also in the second, or `false` otherwise
+ */
+static bool bitmap_is_subset(const Bitmap *self, const Bitmap *other) {
+    if (self->length > other->length) {
+        return false;
+    }
+    auto rhs = other->begin;
+    for (auto lhs = self->begin; lhs < self->begin + self->count; lhs++) {
+        while (rhs < other->begin + other->count && rhs->key < lhs->key) {
+            rhs += 1;
+        }
+        if (rhs == other->begin + other->count || rhs->key != lhs->key ||
+            lhs->length > rhs->length) {
+            return false;
+        }
+        if (lhs->type == BITMAP_ARRAY) {
+            const uint16_t *values = lhs->data;
+            for (long i = 0; i < lhs->count; i++) {
+                if (!x__bitmap_container_find(rhs, values[i])) {
+                    return false;
+                }
+            }
+            continue;
+        }
+        uint64_t words[bitmap_words] = {};
+        uint64_t other_words[bitmap_words] = {};
+        x__bitmap_container_words(lhs, words);
+        x__bitmap_container_words(rhs, other_words);
+        uint64_t missing = 0;
+        for (long i = 0; i < bitmap_words; i++) {
+            missing |= words[i] & ~other_words[i];
+        }
+        if (missing) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check if one bitmap is a superset of another
+ * @param self Pointer to a bitmap
+ * @param other Pointer to another bitmap
+ * @return `true` if all keys in the second bitmap are also in the first, or `false` otherwise
+ */
+static bool bitmap_is_superset(const Bitmap *self, const Bitmap *other) {
+    return bitmap_is_subset(other, self);
+}
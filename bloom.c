@@ -0,0 +1,53 @@
+#include "bloom.h"
+
+#include <stdio.h>
+
+#include "set.h"
+
+static constexpr long mega_byte = 1 << 20;
+
+#define countof(A) ((long)(sizeof(A) / sizeof(*(A))))
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    char *key[] = {"zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine"};
+
+    Bloom bloom = bloom_create(&arena, countof(key), 0);
+    for (long i = 0; i < countof(key); i++) {
+        bloom_insert(&bloom, key[i], 0);
+    }
+
+    Bloom clone = bloom_clone(&bloom, &arena);
+    bloom_insert(&clone, "ten", 0);
+
+    printf("bloom.find(six) = %d\n", bloom_find(&bloom, "six", 0));
+    printf("clone.find(six) = %d\n", bloom_find(&clone, "six", 0));
+
+    printf("bloom.find(ten) = %d\n", bloom_find(&bloom, "ten", 0));
+    printf("clone.find(ten) = %d\n", bloom_find(&clone, "ten", 0));
+
+    bloom_merge(&bloom, &clone);
+    printf("bloom.merge(clone).find(ten) = %d\n", bloom_find(&bloom, "ten", 0));
+
+    constexpr long count = 10000;
+    Bloom numbers = bloom_create(&arena, count, 0);
+    for (long i = 0; i < count; i++) {
+        bloom_insert(&numbers, &i, sizeof(long));
+    }
+    long false_positives = 0;
+    for (long i = count; i < 2 * count; i++) {
+        false_positives += bloom_find(&numbers, &i, sizeof(long));
+    }
+    printf("numbers.false_positives = %ld / %ld\n", false_positives, count);
+
+    Set set = set_create(&arena);
+    set_filter(&set, countof(key), 0);
+    for (long i = 0; i < countof(key); i++) {
+        set_insert(&set, key[i], 0);
+    }
+    printf("set.find(six) = %d\n", set_find(&set, "six", 0));
+    printf("set.find(ten) = %d\n", set_find(&set, "ten", 0));
+
+    arena_destroy(&arena);
+}
@@ -0,0 +1,129 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "arena.h"
+#include "hash.h"
+
+typedef struct Bloom Bloom;
+
+static constexpr long bloom_block_words = 8;  ///< Number of words per block (one cache line)
+static constexpr long bloom_block_bits = 9;   ///< Number of hash bits to select a bit of a block
+static constexpr long bloom_bits = 10;        ///< Default number of bits per key
+
+/**
+ * @brief Represents a blocked Bloom filter for approximate membership queries
+ *
+ * All bits of a key are set in a single block that fits into one cache line, so every insertion
+ * and lookup touches exactly one cache line. Lookups can return false positives, but never false
+ * negatives.
+ */
+struct Bloom {
+    long count;      ///< Number of blocks (power of two)
+    long probes;     ///< Number of bits set per key
+    uint64_t *data;  ///< Pointer to the blocks of bits
+};
+
+/**
+ * @brief Create a new Bloom filter
+ * @param arena Pointer to an arena allocator
+ * @param capacity Expected number of keys
+ * @param bits Number of bits per key (optional)
+ * @return New Bloom filter instance
+ * @note If `bits == 0`, `bloom_bits` bits per key are used (about 1% false positives)
+ */
+static Bloom bloom_create(Arena *arena, long capacity, long bits) {
+    bits = bits ? bits : bloom_bits;
+    Bloom bloom = {};
+    bloom.count = 1;
+    while (bloom.count * bloom_block_words * 64 < capacity * bits) {
+        bloom.count *= 2;
+    }
+    bloom.probes = (bits * 69 + 50) / 100 ? (bits * 69 + 50) / 100 : 1;
+    bloom.data = arena_calloc(arena, bloom.count * bloom_block_words, sizeof(uint64_t),
+                              bloom_block_words * sizeof(uint64_t));
+    return bloom;
+}
+
+/// @private
+static void x__bloom_insert(Bloom *self, uint64_t hash) {
+    constexpr uint64_t golden = 0x9e3779b97f4a7c15;
+    hash = x__hash_mix(hash);
+    auto block = &self->data[(hash & (self->count - 1)) * bloom_block_words];
+    for (long i = 0; i < self->probes; i++) {
+        hash *= golden;
+        long bit = hash >> (64 - bloom_block_bits);
+        block[bit >> 6] |= UINT64_C(1) << (bit & 63);
+    }
+}
+
+/// @private
+static bool x__bloom_find(const Bloom *self, uint64_t hash) {
+    constexpr uint64_t golden = 0x9e3779b97f4a7c15;
+    hash = x__hash_mix(hash);
+    auto block = &self->data[(hash & (self->count - 1)) * bloom_block_words];
+    uint64_t found = 1;
+    for (long i = 0; i < self->probes; i++) {
+        hash *= golden;
+        long bit = hash >> (64 - bloom_block_bits);
+        found &= block[bit >> 6] >> (bit & 63);
+    }
+    return found;
+}
+
+/**
+ * @brief Insert a new key into a Bloom filter
+ * @param self Pointer to a Bloom filter
+ * @param key Pointer to the key data
+ * @param size Size of the key data in bytes (optional)
+ * @note If `size == 0`, `key` is assumed to be a null-terminated string
+ */
+static void bloom_insert(Bloom *self, const void *key, long size) {
+    if (!size) {
+        size = strlen(key) + 1;
+    }
+    x__bloom_insert(self, x__hash_fnv1a(key, size));
+}
+
+/**
+ * @brief Find a key of a Bloom filter
+ * @param self Pointer to a Bloom filter
+ * @param key Pointer to the key data
+ * @param size Size of the key data in bytes (optional)
+ * @return `true` if the key might exist, or `false` if it is definitely not inserted
+ * @note If `size == 0`, `key` is assumed to be a null-terminated string
+ */
+static bool bloom_find(const Bloom *self, const void *key, long size) {
+    if (!size) {
+        size = strlen(key) + 1;
+    }
+    return x__bloom_find(self, x__hash_fnv1a(key, size));
+}
+
+/**
+ * @brief Add the keys of another Bloom filter to a Bloom filter
+ * @param self Pointer to a Bloom filter
+ * @param other Pointer to another Bloom filter
+ * @note Both Bloom filters must have been created with the same capacity and bits per key
+ */
+static void bloom_merge(Bloom *self, const Bloom *other) {
+    assert(self->count == other->count && self->probes == other->probes);
+    for (long i = 0; i < self->count * bloom_block_words; i++) {
+        self->data[i] |= other->data[i];
+    }
+}
+
+/**
+ * @brief Create a clone of a Bloom filter
+ * @param self Pointer to a Bloom filter
+ * @param arena Pointer to an arena allocator
+ * @return Cloned Bloom filter instance
+ */
+static Bloom bloom_clone(const Bloom *self, Arena *arena) {
+    Bloom bloom = *self;
+    bloom.data = arena_memdup(arena, self->data, self->count * bloom_block_words,
+                              sizeof(uint64_t), bloom_block_words * sizeof(uint64_t));
+    return bloom;
+}
@@ -0,0 +1,50 @@
+#include "deque.h"
+
+#include <stdio.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    Deque deque = deque_create(&arena, sizeof(int));
+
+    for (int i = 0; i < 10; i++) {
+        if (i % 2) {
+            deque_push_back(&deque, &i);
+        }
+        else {
+            deque_push_front(&deque, &i);
+        }
+    }
+
+    Deque clone = deque_clone(&deque, nullptr);
+
+    deque_pop_front(&deque);
+    deque_pop_back(&clone);
+
+    printf("a = [");
+    deque_for_each(item, &deque) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("b = [");
+    deque_for_each(item, &clone) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("deque.get(0) = %d\n", *(int *)deque_get(&deque, 0));
+    printf("clone.get(-1) = %d\n", *(int *)deque_get(&clone, -1));
+
+    printf("queue = [");
+    for (int i = 0; i < 20; i++) {
+        deque_push_back(&clone, &i);
+        printf("%d, ", *(int *)deque_pop_front(&clone));
+    }
+    printf("]\n");
+    printf("clone.capacity = %ld\n", clone.capacity);
+
+    arena_destroy(&arena);
+}
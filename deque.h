@@ -0,0 +1,219 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "arena.h"
+
+typedef struct Deque Deque;
+typedef struct DequeItem DequeItem;
+
+typedef void *DequeDataCopy(Arena *, void *, const void *, long);  ///< Data copy function
+
+/**
+ * @brief Represents a double-ended queue
+ *
+ * The items are stored inline in a ring buffer whose capacity is a power of two, or, if the deque
+ * was created with `size == 0`, the data pointers are. Once the buffer is large enough, pushing
+ * and popping at both ends does not allocate.
+ */
+struct Deque {
+    Arena *arena;  ///< Pointer to an arena allocator
+    struct {
+        long size;            ///< Size of the item data in bytes
+        DequeDataCopy *copy;  ///< Pointer to a data copy function
+    } data;                   ///< Data properties
+    long length;              ///< Number of items in the deque
+    long capacity;            ///< Number of allocated items (power of two)
+    long begin;               ///< Index of the first item in the ring buffer
+    char *items;              ///< Pointer to the ring buffer
+};
+
+/**
+ * @brief Represents a single item of a deque
+ */
+struct DequeItem {
+    void *data;  ///< Pointer to the item data
+    long index;  ///< Index of the item in the deque
+};
+
+/**
+ * @brief Iterate over all items of a deque
+ * @param item Current deque item
+ * @param self Pointer to a deque
+ */
+#define deque_for_each(item, self)                                                     \
+    for (DequeItem item[1] = {x__deque_item(self, 0)}; (item)->index < (self)->length; \
+         *(item) = x__deque_item(self, (item)->index + 1))
+
+/**
+ * @brief Create a new deque
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @return New deque instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ */
+static Deque deque_create(Arena *arena, long size) {
+    Deque deque = {};
+    deque.arena = arena;
+    deque.data.size = size;
+    deque.data.copy = arena_memcpy;
+    return deque;
+}
+
+/// @private
+static long x__deque_stride(const Deque *self) {
+    return self->data.size ? self->data.size : (long)sizeof(void *);
+}
+
+/// @private
+static char *x__deque_slot(const Deque *self, long index) {
+    return self->items + ((self->begin + index) & (self->capacity - 1)) * x__deque_stride(self);
+}
+
+/// @private
+static void *x__deque_data(const Deque *self, void *slot) {
+    return self->data.size ? slot : *(void **)slot;
+}
+
+/// @private
+static DequeItem x__deque_item(const Deque *self, long index) {
+    DequeItem item = {};
+    item.index = index;
+    if (index < self->length) {
+        item.data = x__deque_data(self, x__deque_slot(self, index));
+    }
+    return item;
+}
+
+/// @private
+static void x__deque_item_init(const Deque *self, void *slot, void *data) {
+    if (data && self->data.size) {
+        self->data.copy(self->arena, slot, data, self->data.size);
+    }
+    else if (self->data.size) {
+        memset(slot, 0, self->data.size);
+    }
+    else {
+        *(void **)slot = data;
+    }
+}
+
+/**
+ * @brief Reserve space for a number of items in a deque
+ * @param self Pointer to a deque
+ * @param capacity Number of items
+ * @note The capacity is rounded up to a power of two
+ */
+static void deque_reserve(Deque *self, long capacity) {
+    if (capacity <= self->capacity) {
+        return;
+    }
+    long old_capacity = self->capacity;
+    self->capacity = self->capacity ? self->capacity : 1;
+    while (self->capacity < capacity) {
+        self->capacity *= 2;
+    }
+    long stride = x__deque_stride(self);
+    self->items = arena_realloc(self->arena, self->items, self->capacity, stride,
+                                alignof(max_align_t));
+    long wrapped = self->begin + self->length - old_capacity;
+    if (wrapped > 0) {
+        memcpy(self->items + old_capacity * stride, self->items, wrapped * stride);
+    }
+}
+
+/**
+ * @brief Insert a new item at the back of a deque
+ * @param self Pointer to a deque
+ * @param data Pointer to the item data
+ */
+static void deque_push_back(Deque *self, void *data) {
+    deque_reserve(self, self->length + 1);
+    x__deque_item_init(self, x__deque_slot(self, self->length), data);
+    self->length += 1;
+}
+
+/**
+ * @brief Insert a new item at the front of a deque
+ * @param self Pointer to a deque
+ * @param data Pointer to the item data
+ */
+static void deque_push_front(Deque *self, void *data) {
+    deque_reserve(self, self->length + 1);
+    self->begin = (self->begin - 1) & (self->capacity - 1);
+    x__deque_item_init(self, x__deque_slot(self, 0), data);
+    self->length += 1;
+}
+
+/**
+ * @brief Remove the item at the back of a deque
+ * @param self Pointer to a deque
+ * @return Pointer to the item data, or `nullptr` if the deque is empty
+ * @note If the deque stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next insertion
+ */
+static void *deque_pop_back(Deque *self) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    self->length -= 1;
+    return x__deque_data(self, x__deque_slot(self, self->length));
+}
+
+/**
+ * @brief Remove the item at the front of a deque
+ * @param self Pointer to a deque
+ * @return Pointer to the item data, or `nullptr` if the deque is empty
+ * @note If the deque stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next insertion
+ */
+static void *deque_pop_front(Deque *self) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    auto slot = x__deque_slot(self, 0);
+    self->begin = (self->begin + 1) & (self->capacity - 1);
+    self->length -= 1;
+    return x__deque_data(self, slot);
+}
+
+/**
+ * @brief Retrieve an item from a deque
+ * @param self Pointer to a deque
+ * @param index Index of the item to retrieve
+ * @return Pointer to the item data, or `nullptr` if the deque is empty
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ */
+static void *deque_get(const Deque *self, long index) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    assert(-self->length <= index && index < self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    return x__deque_data(self, x__deque_slot(self, index));
+}
+
+/**
+ * @brief Create a clone of a deque
+ * @param self Pointer to a deque
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Cloned deque instance
+ * @note If no arena allocator is passed, the arena allocator of the deque is used
+ * @note The items of the clone start at the beginning of its ring buffer
+ */
+static Deque deque_clone(const Deque *self, Arena *arena) {
+    Deque deque = {};
+    deque.arena = arena ? arena : self->arena;
+    deque.data = self->data;
+    deque_reserve(&deque, self->length);
+    for (long i = 0; i < self->length; i++) {
+        auto data = x__deque_data(self, x__deque_slot(self, i));
+        x__deque_item_init(&deque, x__deque_slot(&deque, i), data);
+    }
+    deque.length = self->length;
+    return deque;
+}
@@ -40,5 +40,18 @@ int main(void) {
     printf("dict.find(ten) = %p\n", dict_find(&dict, "ten", 0));
     printf("clone.find(ten) = %p\n", dict_find(&clone, "ten", 0));
 
+    Dict reuse = dict_create(&arena, sizeof(int));
+    dict_insert(&reuse, "zero", 0, &(int){0});
+    dict_insert(&reuse, "one", 0, &(int){1});
+    dict_remove(&reuse, "zero", 0);
+    dict_insert(&reuse, "one", 0, &(int){2});
+
+    printf("c = {");
+    dict_for_each(item, &reuse) {
+        printf("%s: %d, ", (char *)item->key.data, *(int *)item->data);
+    }
+    printf("}\n");
+    printf("c.length = %ld\n", reuse.length);
+
     arena_destroy(&arena);
 }
@@ -4,6 +4,8 @@
 #include <stddef.h>
 
 #include "arena.h"
+#include "bloom.h"
+#include "hash.h"
 
 typedef struct Dict Dict;
 typedef struct DictItem DictItem;
@@ -25,6 +27,7 @@ struct Dict {
     long length;             ///< Number of items in the dict
     DictItem *begin;         ///< Pointer to root item of the dict
     DictItem *end;           ///< Pointer to last item of the dict
+    Bloom *filter;           ///< Pointer to a Bloom filter of the keys (optional)
 };
 
 /**
@@ -64,18 +67,6 @@ static Dict dict_create(Arena *arena, long size) {
     return dict;
 }
 
-/// @private
-static uint64_t x__dict_hash_fnv1a(const char *key, long size) {
-    constexpr uint64_t basis = 0xcbf29ce484222325;
-    constexpr uint64_t prime = 0x00000100000001b3;
-    uint64_t hash = basis;
-    for (auto byte = key; byte < key + size; byte++) {
-        hash ^= *byte;
-        hash *= prime;
-    }
-    return hash;
-}
-
 /// @private
 static bool x__dict_key_equals(const DictItem *item, const void *key, long size) {
     return item->key.size == size && !memcmp(item->key.data, key, size);
@@ -108,17 +99,22 @@ static void *dict_insert(Dict *self, const void *key, long size, void *data) {
     if (!size) {
         size = strlen(key) + 1;
     }
-    auto item = &self->begin;
-    for (auto hash = x__dict_hash_fnv1a(key, size); *item; hash <<= dict_hash_shift) {
-        if (!(*item)->key.size) {
-            break;
+    auto hash = x__hash_fnv1a(key, size);
+    DictItem **item = &self->begin;
+    DictItem **removed = nullptr;
+    for (auto branch = hash; *item; branch <<= dict_hash_shift) {
+        if (!(*item)->key.size && !removed) {
+            removed = item;
         }
         if (x__dict_key_equals(*item, key, size)) {
             return (*item)->data;
         }
-        item = &(*item)->child[hash >> dict_branch_select];
+        item = &(*item)->child[branch >> dict_branch_select];
+    }
+    if (removed) {
+        item = removed;
     }
-    if (!*item) {
+    else {
         *item = arena_calloc(self->arena, 1, sizeof(DictItem), alignof(DictItem));
         if (self->end) {
             self->end->next = *item;
@@ -126,6 +122,9 @@ static void *dict_insert(Dict *self, const void *key, long size, void *data) {
         self->end = *item;
     }
     x__dict_item_init(self, *item, key, size, data);
+    if (self->filter) {
+        x__bloom_insert(self->filter, hash);
+    }
     self->length += 1;
     return nullptr;
 }
@@ -142,14 +141,18 @@ static void *dict_remove(Dict *self, const void *key, long size) {
     if (!size) {
         size = strlen(key) + 1;
     }
+    auto hash = x__hash_fnv1a(key, size);
+    if (self->filter && !x__bloom_find(self->filter, hash)) {
+        return nullptr;
+    }
     auto item = self->begin;
-    for (auto hash = x__dict_hash_fnv1a(key, size); item; hash <<= dict_hash_shift) {
+    for (auto branch = hash; item; branch <<= dict_hash_shift) {
         if (x__dict_key_equals(item, key, size)) {
             item->key.size = 0;
             self->length -= 1;
             return item->data;
         }
-        item = item->child[hash >> dict_branch_select];
+        item = item->child[branch >> dict_branch_select];
     }
     return nullptr;
 }
@@ -166,22 +169,43 @@ static void *dict_find(const Dict *self, const void *key, long size) {
     if (!size) {
         size = strlen(key) + 1;
     }
+    auto hash = x__hash_fnv1a(key, size);
+    if (self->filter && !x__bloom_find(self->filter, hash)) {
+        return nullptr;
+    }
     auto item = self->begin;
-    for (auto hash = x__dict_hash_fnv1a(key, size); item; hash <<= dict_hash_shift) {
+    for (auto branch = hash; item; branch <<= dict_hash_shift) {
         if (x__dict_key_equals(item, key, size)) {
             return item->data;
         }
-        item = item->child[hash >> dict_branch_select];
+        item = item->child[branch >> dict_branch_select];
     }
     return nullptr;
 }
 
+/**
+ * @brief Attach a Bloom filter to a dict to reject most lookups of absent keys early
+ * @param self Pointer to a dict
+ * @param capacity Expected number of keys
+ * @param bits Number of bits per key (optional)
+ * @note The filter is updated by every insertion, but removed keys remain in the filter
+ * @note If `bits == 0`, the default of `bloom_create()` is used
+ */
+static void dict_filter(Dict *self, long capacity, long bits) {
+    self->filter = arena_malloc(self->arena, 1, sizeof(Bloom), alignof(Bloom));
+    *self->filter = bloom_create(self->arena, capacity, bits);
+    dict_for_each(item, self) {
+        x__bloom_insert(self->filter, x__hash_fnv1a(item->key.data, item->key.size));
+    }
+}
+
 /**
  * @brief Create a clone of a dict
  * @param self Pointer to a dict
  * @param arena Pointer to an arena allocator (optional)
  * @return Cloned dict instance
  * @note If no arena allocator is passed, the arena allocator of the dict is used
+ * @note The Bloom filter of the dict is not cloned
  */
 static Dict dict_clone(const Dict *self, Arena *arena) {
     Dict dict = {};
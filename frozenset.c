@@ -0,0 +1,52 @@
+#include "frozenset.h"
+
+#include <stdio.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+#define countof(A) ((long)(sizeof(A) / sizeof(*(A))))
+
+void frozenset_print(const FrozenSet *set, const char *name);
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    char *key[] = {"zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine"};
+    FrozenSet frozen = frozenset_create(&arena, key, countof(key), 0);
+
+    Set set = set_create(&arena);
+    for (long i = 0; i < countof(key); i++) {
+        set_insert(&set, key[i], 0);
+    }
+    set_remove(&set, "six", 0);
+    set_insert(&set, "ten", 0);
+    FrozenSet other = frozenset_from_set(&arena, &set);
+
+    frozenset_print(&frozen, "a");
+    frozenset_print(&other, "b");
+
+    printf("frozen.find(six) = %d\n", frozenset_find(&frozen, "six", 0));
+    printf("other.find(six) = %d\n", frozenset_find(&other, "six", 0));
+
+    printf("frozen.find(ten) = %d\n", frozenset_find(&frozen, "ten", 0));
+    printf("other.find(ten) = %d\n", frozenset_find(&other, "ten", 0));
+
+    FrozenSet frozen_or_other = frozenset_union(&frozen, &other, &arena);
+    frozenset_print(&frozen_or_other, "frozen_or_other");
+
+    FrozenSet frozen_and_other = frozenset_intersection(&frozen, &other, &arena);
+    frozenset_print(&frozen_and_other, "frozen_and_other");
+
+    Set thaw = frozenset_thaw(&frozen_and_other, &arena);
+    printf("thaw.length = %ld\n", thaw.length);
+
+    arena_destroy(&arena);
+}
+
+void frozenset_print(const FrozenSet *set, const char *name) {
+    printf("%s = {", name);
+    frozenset_for_each(item, set) {
+        printf("%s, ", (char *)item->key.data);
+    }
+    printf("}\n");
+}
@@ -0,0 +1,332 @@
+/// @file
+#pragma once
+
+#include <stddef.h>
+
+#include "arena.h"
+#include "set.h"
+
+typedef struct FrozenSet FrozenSet;
+typedef struct FrozenSetItem FrozenSetItem;
+
+static constexpr long frozenset_gallop_ratio = 32;  ///< Length ratio to switch to galloping
+
+/**
+ * @brief Represents an immutable set of unique keys stored in sorted, contiguous arrays
+ *
+ * Keys are ordered by their hash, which is the same hash that is used by `set.h`. Lookups are
+ * binary searches over the hash array, and intersections and unions are linear merges of the hash
+ * arrays of both operands.
+ */
+struct FrozenSet {
+    long length;           ///< Number of items in the set
+    uint64_t *hash;        ///< Pointer to the sorted array of key hashes
+    FrozenSetItem *items;  ///< Pointer to the array of items, in the same order as the hashes
+};
+
+/**
+ * @brief Represents a single item of a frozen set
+ */
+struct FrozenSetItem {
+    struct {
+        void *data;  ///< Pointer to the key data
+        long size;   ///< Size of the key data in bytes
+    } key;           ///< Key properties
+};
+
+/**
+ * @brief Iterate over all items of a frozen set
+ * @param item Current frozen set item
+ * @param self Pointer to a frozen set
+ */
+#define frozenset_for_each(item, self) \
+    for (auto(item) = (self)->items; item < (self)->items + (self)->length; (item)++)
+
+/// @private
+typedef struct {
+    uint64_t hash;
+    long index;
+} X__FrozenSetEntry;
+
+/// @private
+static void x__frozenset_sort(X__FrozenSetEntry *entry, long count, Arena scratch) {
+    constexpr long radix = 1 << 8;
+    X__FrozenSetEntry *buffer = arena_malloc(&scratch, count, sizeof(X__FrozenSetEntry),
+                                             alignof(X__FrozenSetEntry));
+    for (long shift = 0; shift < 64; shift += 8) {
+        long offset[radix] = {};
+        for (long i = 0; i < count; i++) {
+            offset[entry[i].hash >> shift & (radix - 1)] += 1;
+        }
+        if (offset[entry[0].hash >> shift & (radix - 1)] == count) {
+            continue;
+        }
+        for (long i = 0, total = 0; i < radix; i++) {
+            long swap = offset[i];
+            offset[i] = total;
+            total += swap;
+        }
+        for (long i = 0; i < count; i++) {
+            buffer[offset[entry[i].hash >> shift & (radix - 1)]++] = entry[i];
+        }
+        memcpy(entry, buffer, count * sizeof(X__FrozenSetEntry));
+    }
+}
+
+/// @private
+static bool x__frozenset_key_equals(const FrozenSetItem *item, const void *key, long size) {
+    return item->key.size == size && !memcmp(item->key.data, key, size);
+}
+
+/// @private
+static long x__frozenset_scratch_capacity(long count) {
+    long size = sizeof(FrozenSetItem) + sizeof(uint64_t) + 2 * sizeof(X__FrozenSetEntry);
+    return count * size + 4 * alignof(max_align_t);
+}
+
+/// @private
+static FrozenSet x__frozenset_freeze(Arena *arena, Arena scratch, const FrozenSetItem *keys,
+                                     const uint64_t *hash, long count) {
+    FrozenSet set = {};
+    set.hash = arena_malloc(arena, count, sizeof(uint64_t), alignof(uint64_t));
+    set.items = arena_malloc(arena, count, sizeof(FrozenSetItem), alignof(FrozenSetItem));
+    if (!count) {
+        return set;
+    }
+    X__FrozenSetEntry *entry = arena_malloc(&scratch, count, sizeof(X__FrozenSetEntry),
+                                            alignof(X__FrozenSetEntry));
+    long total = 0;
+    for (long i = 0; i < count; i++) {
+        entry[i].hash = hash[i];
+        entry[i].index = i;
+        total += (keys[i].key.size + alignof(max_align_t) - 1) & -alignof(max_align_t);
+    }
+    x__frozenset_sort(entry, count, scratch);
+    char *data = arena_malloc(arena, total, 1, alignof(max_align_t));
+    for (long i = 0; i < count; i++) {
+        auto key = &keys[entry[i].index];
+        bool duplicate = false;
+        for (long j = set.length - 1; j >= 0 && set.hash[j] == entry[i].hash; j--) {
+            if (x__frozenset_key_equals(&set.items[j], key->key.data, key->key.size)) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (duplicate) {
+            continue;
+        }
+        set.hash[set.length] = entry[i].hash;
+        set.items[set.length].key.data = memcpy(data, key->key.data, key->key.size);
+        set.items[set.length].key.size = key->key.size;
+        data += (key->key.size + alignof(max_align_t) - 1) & -alignof(max_align_t);
+        set.length += 1;
+    }
+    return set;
+}
+
+/**
+ * @brief Create a new frozen set from an array of keys
+ * @param arena Pointer to an arena allocator
+ * @param keys Pointer to an array of keys
+ * @param count Number of keys
+ * @param size Size of a single key in bytes (optional)
+ * @return New frozen set instance
+ * @note If `size == 0`, `keys` is assumed to be an array of pointers to null-terminated strings
+ * @note Duplicate keys are only stored once
+ */
+static FrozenSet frozenset_create(Arena *arena, const void *keys, long count, long size) {
+    Arena scratch = arena_scratch_create(arena, x__frozenset_scratch_capacity(count));
+    FrozenSetItem *items = arena_malloc(&scratch, count, sizeof(FrozenSetItem),
+                                        alignof(FrozenSetItem));
+    uint64_t *hash = arena_malloc(&scratch, count, sizeof(uint64_t), alignof(uint64_t));
+    for (long i = 0; i < count; i++) {
+        if (size) {
+            items[i].key.data = (char *)keys + i * size;
+            items[i].key.size = size;
+        }
+        else {
+            items[i].key.data = ((char *const *)keys)[i];
+            items[i].key.size = strlen(items[i].key.data) + 1;
+        }
+        hash[i] = x__hash_fnv1a(items[i].key.data, items[i].key.size);
+    }
+    auto set = x__frozenset_freeze(arena, scratch, items, hash, count);
+    arena_scratch_destroy(arena, scratch);
+    return set;
+}
+
+/**
+ * @brief Create a new frozen set from the items of a set
+ * @param arena Pointer to an arena allocator
+ * @param set Pointer to a set
+ * @return New frozen set instance
+ * @note The hashes stored in the set items are reused
+ */
+static FrozenSet frozenset_from_set(Arena *arena, const Set *set) {
+    Arena scratch = arena_scratch_create(arena, x__frozenset_scratch_capacity(set->length));
+    FrozenSetItem *items = arena_malloc(&scratch, set->length, sizeof(FrozenSetItem),
+                                        alignof(FrozenSetItem));
+    uint64_t *hash = arena_malloc(&scratch, set->length, sizeof(uint64_t), alignof(uint64_t));
+    long index = 0;
+    set_for_each(item, set) {
+        items[index].key.data = item->key.data;
+        items[index].key.size = item->key.size;
+        hash[index++] = item->key.hash;
+    }
+    auto frozen = x__frozenset_freeze(arena, scratch, items, hash, set->length);
+    arena_scratch_destroy(arena, scratch);
+    return frozen;
+}
+
+/// @private
+static long x__frozenset_lower_bound(const uint64_t *hash, long length, uint64_t value) {
+    if (!length) {
+        return 0;
+    }
+    auto base = hash;
+    while (length > 1) {
+        long half = length / 2;
+        base = base[half] < value ? base + half : base;
+        length -= half;
+    }
+    return (base - hash) + (*base < value);
+}
+
+/**
+ * @brief Find an item of a frozen set
+ * @param self Pointer to a frozen set
+ * @param key Pointer to the key data
+ * @param size Size of the key data in bytes (optional)
+ * @return `true` if the key exists, or `false` if it is not found
+ * @note If `size == 0`, `key` is assumed to be a null-terminated string
+ */
+static bool frozenset_find(const FrozenSet *self, const void *key, long size) {
+    if (!size) {
+        size = strlen(key) + 1;
+    }
+    uint64_t hash = x__hash_fnv1a(key, size);
+    for (long i = x__frozenset_lower_bound(self->hash, self->length, hash);
+         i < self->length && self->hash[i] == hash; i++) {
+        if (x__frozenset_key_equals(&self->items[i], key, size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Create a set from a frozen set
+ * @param self Pointer to a frozen set
+ * @param arena Pointer to an arena allocator
+ * @return New set instance
+ */
+static Set frozenset_thaw(const FrozenSet *self, Arena *arena) {
+    Set set = set_create(arena);
+    for (long i = 0; i < self->length; i++) {
+        x__set_insert(&set, self->items[i].key.data, self->items[i].key.size, self->hash[i]);
+    }
+    return set;
+}
+
+/// @private
+static bool x__frozenset_contains(const FrozenSet *self, long begin, const FrozenSetItem *item,
+                                  uint64_t hash) {
+    for (long i = begin; i < self->length && self->hash[i] == hash; i++) {
+        if (x__frozenset_key_equals(&self->items[i], item->key.data, item->key.size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @private
+static void x__frozenset_append(FrozenSet *self, const FrozenSet *other, long index) {
+    self->hash[self->length] = other->hash[index];
+    self->items[self->length] = other->items[index];
+    self->length += 1;
+}
+
+/**
+ * @brief Compute the intersection of two frozen sets
+ * @param self Pointer to a frozen set
+ * @param other Pointer to another frozen set
+ * @param arena Pointer to an arena allocator
+ * @return New frozen set containing items common to both sets
+ * @note The items of the new frozen set refer to the key data of `self` or `other`
+ * @note If one set is much smaller than the other, its hashes are galloped through the larger set
+ */
+static FrozenSet frozenset_intersection(const FrozenSet *self, const FrozenSet *other,
+                                        Arena *arena) {
+    long length = self->length < other->length ? self->length : other->length;
+    FrozenSet set = {};
+    set.hash = arena_malloc(arena, length, sizeof(uint64_t), alignof(uint64_t));
+    set.items = arena_malloc(arena, length, sizeof(FrozenSetItem), alignof(FrozenSetItem));
+    if (self->length * frozenset_gallop_ratio < other->length ||
+        other->length * frozenset_gallop_ratio < self->length) {
+        auto small = self->length < other->length ? self : other;
+        auto large = self->length < other->length ? other : self;
+        long lower = 0;
+        for (long i = 0; i < small->length; i++) {
+            long step = 1;
+            while (lower + step < large->length && large->hash[lower + step] < small->hash[i]) {
+                step *= 2;
+            }
+            long upper = lower + step < large->length ? lower + step + 1 : large->length;
+            lower += x__frozenset_lower_bound(large->hash + lower, upper - lower, small->hash[i]);
+            if (x__frozenset_contains(large, lower, &small->items[i], small->hash[i])) {
+                x__frozenset_append(&set, small, i);
+            }
+        }
+        return set;
+    }
+    long i = 0;
+    long j = 0;
+    while (i < self->length && j < other->length) {
+        uint64_t lhs = self->hash[i];
+        uint64_t rhs = other->hash[j];
+        if (lhs == rhs && x__frozenset_contains(other, j, &self->items[i], lhs)) {
+            x__frozenset_append(&set, self, i);
+        }
+        i += lhs <= rhs;
+        j += rhs < lhs || (lhs == rhs && (i == self->length || self->hash[i] != lhs));
+    }
+    return set;
+}
+
+/**
+ * @brief Compute the union of two frozen sets
+ * @param self Pointer to a frozen set
+ * @param other Pointer to another frozen set
+ * @param arena Pointer to an arena allocator
+ * @return New frozen set containing all unique items from both sets
+ * @note The items of the new frozen set refer to the key data of `self` and `other`
+ */
+static FrozenSet frozenset_union(const FrozenSet *self, const FrozenSet *other, Arena *arena) {
+    long length = self->length + other->length;
+    FrozenSet set = {};
+    set.hash = arena_malloc(arena, length, sizeof(uint64_t), alignof(uint64_t));
+    set.items = arena_malloc(arena, length, sizeof(FrozenSetItem), alignof(FrozenSetItem));
+    long i = 0;
+    long j = 0;
+    while (i < self->length || j < other->length) {
+        if (j == other->length || (i < self->length && self->hash[i] < other->hash[j])) {
+            x__frozenset_append(&set, self, i++);
+        }
+        else if (i == self->length || other->hash[j] < self->hash[i]) {
+            x__frozenset_append(&set, other, j++);
+        }
+        else {
+            uint64_t hash = self->hash[i];
+            long begin = i;
+            while (i < self->length && self->hash[i] == hash) {
+                x__frozenset_append(&set, self, i++);
+            }
+            for (; j < other->length && other->hash[j] == hash; j++) {
+                if (!x__frozenset_contains(self, begin, &other->items[j], hash)) {
+                    x__frozenset_append(&set, other, j);
+                }
+            }
+        }
+    }
+    return set;
+}
@@ -0,0 +1,26 @@
+/// @file
+#pragma once
+
+#include <stdint.h>
+
+/// @private
+static uint64_t x__hash_fnv1a(const char *key, long size) {
+    constexpr uint64_t basis = 0xcbf29ce484222325;
+    constexpr uint64_t prime = 0x00000100000001b3;
+    uint64_t hash = basis;
+    for (auto byte = key; byte < key + size; byte++) {
+        hash ^= (unsigned char)*byte;
+        hash *= prime;
+    }
+    return hash;
+}
+
+/// @private
+static uint64_t x__hash_mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccd;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53;
+    hash ^= hash >> 33;
+    return hash;
+}
@@ -1,19 +1,36 @@
 #include "heap.h"
 
 #include <stdio.h>
+#include <time.h>
 
 static constexpr long mega_byte = 1 << 20;
 
+static constexpr long operations = 1 << 20;
+
+#define countof(A) ((long)(sizeof(A) / sizeof(*(A))))
+
 int intcmp(const void *_a, const void *_b, void *) {
     const int *lhs = _a;
     const int *rhs = _b;
     return (*lhs > *rhs) - (*lhs < *rhs);
 }
 
+int longcmp(const void *_a, const void *_b, void *) {
+    const long *lhs = _a;
+    const long *rhs = _b;
+    return (*lhs > *rhs) - (*lhs < *rhs);
+}
+
+double now(void) {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + 1e-9 * time.tv_nsec;
+}
+
 int main(void) {
-    Arena arena = arena_create(mega_byte);
+    Arena arena = arena_create(64 * mega_byte);
 
-    Heap heap = heap_create(&arena, sizeof(int), intcmp);
+    Heap heap = heap_create(&arena, sizeof(int), intcmp, 0);
 
     for (int i = 9; i >= 0; i--) {
         heap_push(&heap, &i, nullptr);
@@ -39,5 +56,133 @@ int main(void) {
     printf("heap.peek() = %d\n", *(int *)heap_peek(&heap));
     printf("clone.peek() = %d\n", *(int *)heap_peek(&clone));
 
+    int array[] = {5, 3, 8, 1, 9, 2, 7};
+    Heap floyd = heap_from_array(&arena, sizeof(int), intcmp, 0, array, countof(array), nullptr);
+
+    printf("floyd.pop() = [");
+    while (floyd.length) {
+        printf("%d, ", *(int *)heap_pop(&floyd, nullptr));
+    }
+    printf("]\n");
+
+    Heap quaternary = heap_create(&arena, sizeof(int), intcmp, 4);
+    for (int i = 9; i >= 0; i--) {
+        heap_push(&quaternary, &i, nullptr);
+    }
+
+    printf("c = [");
+    heap_for_each(item, &quaternary) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("quaternary.pop() = [");
+    while (quaternary.length) {
+        printf("%d, ", *(int *)heap_pop(&quaternary, nullptr));
+    }
+    printf("]\n");
+
+    Heap tasks = heap_create(&arena, sizeof(int), intcmp, 0);
+    heap_track(&tasks);
+    long handle[5];
+    for (int i = 0; i < 5; i++) {
+        int priority = 10 * (i + 1);
+        handle[i] = heap_push(&tasks, &priority, nullptr);
+    }
+
+    int priority = 5;
+    heap_update(&tasks, handle[3], &priority, nullptr);
+    heap_remove(&tasks, handle[0], nullptr);
+    printf("tasks.get(3) = %d\n", *(int *)heap_get(&tasks, handle[3]));
+
+    printf("tasks.pop() = [");
+    while (tasks.length) {
+        printf("%d, ", *(int *)heap_pop(&tasks, nullptr));
+    }
+    printf("]\n");
+
+    PairingHeap even = pairing_heap_create(&arena, sizeof(int), intcmp);
+    PairingHeap odd = pairing_heap_create(&arena, sizeof(int), intcmp);
+    for (int i = 9; i >= 0; i--) {
+        pairing_heap_push(i % 2 ? &odd : &even, &i, nullptr);
+    }
+
+    pairing_heap_meld(&even, &odd, nullptr);
+
+    printf("even.pop() = [");
+    while (even.length) {
+        printf("%d, ", *(int *)pairing_heap_pop(&even, nullptr));
+    }
+    printf("]\n");
+
+    RadixHeap radix = radix_heap_create(&arena, sizeof(int));
+    for (int i = 9; i >= 0; i--) {
+        radix_heap_push(&radix, 10 * (i % 5), &i);
+    }
+
+    printf("radix.pop() = [");
+    while (radix.length) {
+        uint64_t key = 0;
+        int *data = radix_heap_pop(&radix, &key);
+        printf("%d: %d, ", (int)key, *data);
+        if (key < 20) {
+            radix_heap_push(&radix, key + 25, data);
+        }
+    }
+    printf("]\n");
+
+    Heap top = heap_create(&arena, sizeof(int), intcmp, 0);
+    for (int i = 0; i < 100; i++) {
+        int value = (37 * i) % 101;
+        heap_push_bounded(&top, 3, &value, nullptr);
+    }
+
+    printf("top.pop() = [");
+    while (top.length) {
+        printf("%d, ", *(int *)heap_pop(&top, nullptr));
+    }
+    printf("]\n");
+
+    List sorted = list_create(&arena, sizeof(int), nullptr);
+    for (int i = 0; i < 10; i += 3) {
+        list_append(&sorted, &i);
+    }
+    int primes[] = {2, 3, 5, 7};
+    int powers[] = {2, 4, 8};
+
+    HeapMerge merge = heap_merge_create(&arena, intcmp, nullptr);
+    heap_merge_list(&merge, &sorted);
+    heap_merge_array(&merge, primes, countof(primes), sizeof(int));
+    heap_merge_array(&merge, powers, countof(powers), sizeof(int));
+
+    printf("merge = [");
+    for (int *data; (data = heap_merge_next(&merge));) {
+        printf("%d, ", *data);
+    }
+    printf("]\n");
+
+    for (long arity = 2; arity <= 8; arity *= 2) {
+        Arena scratch = arena;
+        Heap dijkstra = heap_create(&scratch, sizeof(long), longcmp, arity);
+        uint64_t random = 0x9e3779b97f4a7c15;
+        for (long i = 0; i < operations / 4; i++) {
+            random = 6364136223846793005 * random + 1442695040888963407;
+            long distance = random >> 44;
+            heap_push(&dijkstra, &distance, nullptr);
+        }
+        double start = now();
+        for (long i = 0; i < operations; i++) {
+            long distance = *(long *)heap_pop(&dijkstra, nullptr);
+            for (long edge = 0; edge < 1 + i % 2; edge++) {
+                random = 6364136223846793005 * random + 1442695040888963407;
+                long next = distance + (long)(random >> 54);
+                heap_push(&dijkstra, &next, nullptr);
+            }
+        }
+        double time = now() - start;
+        printf("arity = %ld: length = %ld, %.2f Mops/s\n", arity, dijkstra.length,
+               2.5e-6 * operations / time);
+    }
+
     arena_destroy(&arena);
 }
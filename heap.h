@@ -1,18 +1,36 @@
 /// @file
 #pragma once
 
+#include <assert.h>
+#include <stdbit.h>
 #include <stddef.h>
 
 #include "arena.h"
+#include "list.h"
 
 typedef struct Heap Heap;
 typedef struct HeapItem HeapItem;
+typedef struct HeapMerge HeapMerge;
+typedef struct PairingHeap PairingHeap;
+typedef struct PairingHeapItem PairingHeapItem;
+typedef struct RadixHeap RadixHeap;
 
 typedef int HeapDataCompare(const void *, const void *, void *);  ///< Data comparison function
 typedef void *HeapDataCopy(Arena *, void *, const void *, long);  ///< Data copy function
 
+static constexpr long heap_arity = 2;           ///< Default number of children per item
+static constexpr long radix_heap_buckets = 65;  ///< Number of buckets of a radix heap
+
 /**
- * @brief Represents a binary heap (min-heap by default)
+ * @brief Represents a d-ary heap (binary min-heap by default)
+ *
+ * The heap is stored implicitly in a contiguous array: the children of the item at index `i` are
+ * at the indices `arity * i + 1` to `arity * i + arity`. The item data is stored inline in the
+ * array, or, if the heap was created with `size == 0`, the data pointers are.
+ *
+ * If handles are enabled with `heap_track()`, every item is identified by a handle that stays valid
+ * while the item is in the heap, even though the item moves around in the array. Handles of removed
+ * items are reused by later insertions. Without handles, the heap only stores the item array.
  */
 struct Heap {
     Arena *arena;  ///< Pointer to an arena allocator
@@ -21,20 +39,24 @@ struct Heap {
         HeapDataCompare *compare;  ///< Pointer to a data comparison function
         HeapDataCopy *copy;        ///< Pointer to a data copy function
     } data;                        ///< Data properties
+    long arity;                    ///< Number of children per item
     long length;                   ///< Number of items in the heap
-    HeapItem *begin;               ///< Pointer to the root item of the heap
-    HeapItem *end;                 ///< Pointer to the last item in the heap
+    long capacity;                 ///< Number of allocated items
+    char *items;                   ///< Pointer to the item array, preceded by one scratch item
+    bool track;                    ///< Whether the items are identified by handles
+    long *handle;                  ///< Pointer to the handle of each item (optional)
+    long *index;                   ///< Pointer to the item index of each handle (optional)
+    long handles;                  ///< Number of handles in use or on the free list
+    long free;                     ///< First free handle plus one, or `0` if there is none
 };
 
 /**
  * @brief Represents a single item in the heap
  */
 struct HeapItem {
-    void *data;        ///< Pointer to the item data
-    HeapItem *parent;  ///< Pointer to the parent item
-    HeapItem *left;    ///< Pointer to the left child item
-    HeapItem *right;   ///< Pointer to the right child item
-    HeapItem *next;    ///< Pointer to the next item in insertion order
+    void *data;   ///< Pointer to the item data
+    long index;   ///< Index of the item in the item array
+    long handle;  ///< Handle of the item, or `-1` if handles are not enabled
 };
 
 /**
@@ -42,128 +64,229 @@ struct HeapItem {
  * @param item Current heap item
  * @param self Pointer to a heap
  */
-#define heap_for_each(item, self) for (auto(item) = (self)->begin; item; (item) = (item)->next)
+#define heap_for_each(item, self)                                                   \
+    for (HeapItem item[1] = {x__heap_item(self, 0)}; (item)->index < (self)->length; \
+         *(item) = x__heap_item(self, (item)->index + 1))
 
 /**
  * @brief Create a new heap
  * @param arena Pointer to an arena allocator
  * @param size Size of item data in bytes (optional)
  * @param compare Pointer to a data comparison function
+ * @param arity Number of children per item (optional)
  * @return New heap instance
  * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ * @note If `arity == 0`, `heap_arity` children per item are used, otherwise it must be at least 2;
+ * an arity of 4 or 8 makes the tree shallower, which pays off for pop-heavy workloads
  */
-static Heap heap_create(Arena *arena, long size, HeapDataCompare *compare) {
+static Heap heap_create(Arena *arena, long size, HeapDataCompare *compare, long arity) {
+    assert(arity == 0 || arity >= 2);
     Heap heap = {};
     heap.arena = arena;
     heap.data.size = size;
     heap.data.compare = compare;
     heap.data.copy = arena_memcpy;
+    heap.arity = arity ? arity : heap_arity;
     return heap;
 }
 
 /// @private
-static void x__heap_item_init(const Heap *self, HeapItem *item, void *data) {
+static long x__heap_stride(const Heap *self) {
+    return self->data.size ? self->data.size : (long)sizeof(void *);
+}
+
+/// @private
+static void *x__heap_slot(const Heap *self, long index) {
+    return self->items + (index + 1) * x__heap_stride(self);
+}
+
+/// @private
+static void *x__heap_data(const Heap *self, void *slot) {
+    return self->data.size ? slot : *(void **)slot;
+}
+
+/// @private
+static HeapItem x__heap_item(const Heap *self, long index) {
+    HeapItem item = {};
+    item.index = index;
+    if (index < self->length) {
+        item.data = x__heap_data(self, x__heap_slot(self, index));
+        item.handle = self->track ? self->handle[index] : -1;
+    }
+    return item;
+}
+
+/// @private
+static void x__heap_item_init(const Heap *self, void *slot, void *data) {
     if (data && self->data.size) {
-        item->data = arena_malloc(self->arena, 1, self->data.size, alignof(max_align_t));
-        self->data.copy(self->arena, item->data, data, self->data.size);
+        self->data.copy(self->arena, slot, data, self->data.size);
+    }
+    else if (self->data.size) {
+        memset(slot, 0, self->data.size);
     }
     else {
-        item->data = data;
+        *(void **)slot = data;
     }
 }
 
 /// @private
-static HeapItem *x__heap_find_parent(HeapItem *item) {
-    while (item->parent && item == item->parent->right) {
-        item = item->parent;
+static void x__heap_reserve(Heap *self, long capacity) {
+    if (capacity <= self->capacity) {
+        return;
     }
-    if (item->parent) {
-        if (item->parent->right) {
-            item = item->parent->right;
-        }
-        else {
-            return item->parent;
-        }
+    self->capacity = self->capacity ? 2 * self->capacity : 1;
+    if (self->capacity < capacity) {
+        self->capacity = capacity;
     }
-    while (item->left) {
-        item = item->left;
+    self->items = arena_realloc(self->arena, self->items, self->capacity + 1, x__heap_stride(self),
+                                alignof(max_align_t));
+    if (self->track) {
+        self->handle = arena_realloc(self->arena, self->handle, self->capacity, sizeof(long),
+                                     alignof(long));
+        self->index = arena_realloc(self->arena, self->index, self->capacity, sizeof(long),
+                                    alignof(long));
     }
-    return item;
 }
 
 /// @private
-static void x__heap_sift_up(const Heap *self, HeapItem *item, void *context) {
-    while (item->parent && self->data.compare(item->parent->data, item->data, context) > 0) {
-        auto swap = item->data;
-        item->data = item->parent->data;
-        item->parent->data = swap;
-        item = item->parent;
+static void x__heap_handle_set(Heap *self, long index, long handle) {
+    if (self->track) {
+        self->handle[index] = handle;
+        self->index[handle] = index;
     }
 }
 
-/**
- * @brief Insert a new item into a heap
- * @param self Pointer to a heap
- * @param data Pointer to the item data
- * @param context Pointer to a user-provided context for the comparison function (optional)
- */
-static void heap_push(Heap *self, void *data, void *context) {
-    HeapItem *item = arena_calloc(self->arena, 1, sizeof(HeapItem), alignof(HeapItem));
-    x__heap_item_init(self, item, data);
-    if (self->length == 0) {
-        self->begin = item;
-        self->end = item;
+/// @private
+static void x__heap_move(Heap *self, long index, long other) {
+    memcpy(x__heap_slot(self, index), x__heap_slot(self, other), x__heap_stride(self));
+    x__heap_handle_set(self, index, self->track ? self->handle[other] : -1);
+}
+
+/// @private
+static void x__heap_swap(Heap *self, long index, long other) {
+    if (index == other) {
+        return;
     }
-    else {
-        auto parent = x__heap_find_parent(self->end);
-        assert(!parent->right);
-        item->parent = parent;
-        if (!parent->left) {
-            parent->left = item;
+    memcpy(x__heap_slot(self, -1), x__heap_slot(self, index), x__heap_stride(self));
+    long handle = self->track ? self->handle[index] : -1;
+    x__heap_move(self, index, other);
+    memcpy(x__heap_slot(self, other), x__heap_slot(self, -1), x__heap_stride(self));
+    x__heap_handle_set(self, other, handle);
+}
+
+/// @private
+static void x__heap_sift_up(Heap *self, long index, void *context) {
+    long stride = x__heap_stride(self);
+    auto scratch = x__heap_slot(self, -1);
+    memcpy(scratch, x__heap_slot(self, index), stride);
+    long handle = self->track ? self->handle[index] : -1;
+    auto data = x__heap_data(self, scratch);
+    while (index > 0) {
+        long parent = (index - 1) / self->arity;
+        if (self->data.compare(x__heap_data(self, x__heap_slot(self, parent)), data, context) <=
+            0) {
+            break;
         }
-        else {
-            parent->right = item;
+        x__heap_move(self, index, parent);
+        index = parent;
+    }
+    memcpy(x__heap_slot(self, index), scratch, stride);
+    x__heap_handle_set(self, index, handle);
+}
+
+/// @private
+static void x__heap_sift_down(Heap *self, long index, void *context) {
+    long stride = x__heap_stride(self);
+    auto scratch = x__heap_slot(self, -1);
+    memcpy(scratch, x__heap_slot(self, index), stride);
+    long handle = self->track ? self->handle[index] : -1;
+    auto data = x__heap_data(self, scratch);
+    while (self->arity * index + 1 < self->length) {
+        long child = self->arity * index + 1;
+        long end = child + self->arity < self->length ? child + self->arity : self->length;
+        auto slot = x__heap_slot(self, child);
+        for (long other = child + 1; other < end; other++) {
+            auto other_slot = x__heap_slot(self, other);
+            if (self->data.compare(x__heap_data(self, other_slot), x__heap_data(self, slot),
+                                   context) < 0) {
+                child = other;
+                slot = other_slot;
+            }
+        }
+        if (self->data.compare(x__heap_data(self, slot), data, context) >= 0) {
+            break;
         }
-        self->end->next = item;
-        self->end = item;
-        x__heap_sift_up(self, item, context);
+        x__heap_move(self, index, child);
+        index = child;
     }
-    self->length += 1;
+    memcpy(x__heap_slot(self, index), scratch, stride);
+    x__heap_handle_set(self, index, handle);
 }
 
 /// @private
-static HeapItem *x__heap_find_end(HeapItem *item) {
-    while (item->parent && item == item->parent->left) {
-        item = item->parent;
+static long x__heap_handle_create(Heap *self, long index) {
+    if (!self->track) {
+        return -1;
     }
-    if (item->parent) {
-        assert(item->parent->left);
-        item = item->parent->left;
+    long handle = self->handles;
+    if (self->free) {
+        handle = self->free - 1;
+        self->free = -1 - self->index[handle];
     }
-    while (item->right) {
-        item = item->right;
+    else {
+        self->handles += 1;
     }
-    return item;
+    x__heap_handle_set(self, index, handle);
+    return handle;
 }
 
 /// @private
-static void x__heap_sift_down(const Heap *self, HeapItem *item, void *context) {
-    while (item) {
-        auto smallest = item;
-        if (item->left && self->data.compare(item->left->data, smallest->data, context) < 0) {
-            smallest = item->left;
-        }
-        if (item->right && self->data.compare(item->right->data, smallest->data, context) < 0) {
-            smallest = item->right;
-        }
-        if (smallest == item) {
-            break;
-        }
-        auto swap = item->data;
-        item->data = smallest->data;  // cppcheck-suppress nullPointerRedundantCheck
-        smallest->data = swap;        // cppcheck-suppress nullPointerRedundantCheck
-        item = smallest;
+static void x__heap_handle_destroy(Heap *self, long handle) {
+    if (self->track) {
+        self->index[handle] = -1 - self->free;
+        self->free = handle + 1;
+    }
+}
+
+/**
+ * @brief Identify the items of a heap by handles
+ * @param self Pointer to a heap
+ * @note The items that are already in the heap get the handles `0` to `self->length - 1` in the
+ * order of the item array
+ * @note Handles cost two extra integers per item and extra stores on every move of an item, so
+ * they are only enabled if `heap_get()`, `heap_update()`, or `heap_remove()` are needed
+ */
+static void heap_track(Heap *self) {
+    if (self->track) {
+        return;
+    }
+    self->track = true;
+    if (self->capacity) {
+        self->handle = arena_malloc(self->arena, self->capacity, sizeof(long), alignof(long));
+        self->index = arena_malloc(self->arena, self->capacity, sizeof(long), alignof(long));
+    }
+    for (long i = 0; i < self->length; i++) {
+        x__heap_handle_set(self, i, i);
     }
+    self->handles = self->length;
+    self->free = 0;
+}
+
+/**
+ * @brief Insert a new item into a heap
+ * @param self Pointer to a heap
+ * @param data Pointer to the item data
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return Handle of the new item, or `-1` if handles are not enabled (see `heap_track()`)
+ */
+static long heap_push(Heap *self, void *data, void *context) {
+    assert(self->arity >= 2);
+    x__heap_reserve(self, self->length + 1);
+    x__heap_item_init(self, x__heap_slot(self, self->length), data);
+    long handle = x__heap_handle_create(self, self->length);
+    self->length += 1;
+    x__heap_sift_up(self, self->length - 1, context);
+    return handle;
 }
 
 /**
@@ -171,32 +294,56 @@ static void x__heap_sift_down(const Heap *self, HeapItem *item, void *context) {
  * @param self Pointer to a heap
  * @param context Pointer to a user-provided context for the comparison function (optional)
  * @return Pointer to the item data, or `nullptr` if the heap is empty
+ * @note If the heap stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next insertion
  */
 static void *heap_pop(Heap *self, void *context) {
     if (self->length == 0) {
         return nullptr;
     }
-    void *data = self->begin->data;
-    if (self->length == 1) {
-        self->begin = nullptr;
-        self->end = nullptr;
+    x__heap_swap(self, 0, self->length - 1);
+    self->length -= 1;
+    if (self->track) {
+        x__heap_handle_destroy(self, self->handle[self->length]);
     }
-    else {
-        assert(self->end->parent);
-        auto end = x__heap_find_end(self->end);
-        if (self->end == self->end->parent->right) {
-            self->end->parent->right = nullptr;
-        }
-        else {
-            self->end->parent->left = nullptr;
-        }
-        self->begin->data = self->end->data;
-        self->end = end;
-        self->end->next = nullptr;
-        x__heap_sift_down(self, self->begin, context);
+    if (self->length > 1) {
+        x__heap_sift_down(self, 0, context);
     }
-    self->length -= 1;
-    return data;
+    return x__heap_data(self, x__heap_slot(self, self->length));
+}
+
+/**
+ * @brief Insert a new item into a heap that holds at most a given number of items
+ * @param self Pointer to a heap
+ * @param capacity Maximum number of items
+ * @param data Pointer to the item data
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return Handle of the new item, or `-1` if the item was rejected or handles are not enabled
+ * @note Once the heap is full, the root item is replaced if the new item compares greater, so the
+ * heap keeps the `capacity` greatest items (use a reversed comparison function for the smallest)
+ * @note If handles are enabled, the handle of the replaced root item is released as if the item
+ * was popped, and the new item gets a different handle
+ */
+static long heap_push_bounded(Heap *self, long capacity, void *data, void *context) {
+    assert(capacity > 0);
+    if (self->length < capacity) {
+        return heap_push(self, data, context);
+    }
+    auto root = x__heap_slot(self, 0);
+    if (self->data.compare(data, x__heap_data(self, root), context) <= 0) {
+        return -1;
+    }
+    long handle = -1;
+    if (self->track) {
+        x__heap_reserve(self, self->length + 1);
+        root = x__heap_slot(self, 0);
+        long evicted = self->handle[0];
+        handle = x__heap_handle_create(self, 0);
+        x__heap_handle_destroy(self, evicted);
+    }
+    x__heap_item_init(self, root, data);
+    x__heap_sift_down(self, 0, context);
+    return handle;
 }
 
 /**
@@ -208,7 +355,96 @@ static void *heap_peek(const Heap *self) {
     if (self->length == 0) {
         return nullptr;
     }
-    return self->begin->data;
+    return x__heap_data(self, x__heap_slot(self, 0));
+}
+
+/**
+ * @brief Retrieve an item of the heap by its handle
+ * @param self Pointer to a heap
+ * @param handle Handle of the item
+ * @return Pointer to the item data
+ * @note This function requires handles to be enabled (see `heap_track()`)
+ */
+static void *heap_get(const Heap *self, long handle) {
+    assert(self->track);
+    assert(0 <= handle && handle < self->handles && self->index[handle] >= 0);
+    return x__heap_data(self, x__heap_slot(self, self->index[handle]));
+}
+
+/**
+ * @brief Replace the data of an item and restore the heap order
+ * @param self Pointer to a heap
+ * @param handle Handle of the item
+ * @param data Pointer to the new item data
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @note This function can both decrease and increase the priority of an item
+ * @note This function requires handles to be enabled (see `heap_track()`)
+ */
+static void heap_update(Heap *self, long handle, void *data, void *context) {
+    assert(self->track);
+    assert(0 <= handle && handle < self->handles && self->index[handle] >= 0);
+    long index = self->index[handle];
+    x__heap_item_init(self, x__heap_slot(self, index), data);
+    x__heap_sift_up(self, index, context);
+    if (self->index[handle] == index) {
+        x__heap_sift_down(self, index, context);
+    }
+}
+
+/**
+ * @brief Remove an item from the heap by its handle
+ * @param self Pointer to a heap
+ * @param handle Handle of the item
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return Pointer to the item data
+ * @note If the heap stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next insertion
+ * @note This function requires handles to be enabled (see `heap_track()`)
+ */
+static void *heap_remove(Heap *self, long handle, void *context) {
+    assert(self->track);
+    assert(0 <= handle && handle < self->handles && self->index[handle] >= 0);
+    long index = self->index[handle];
+    x__heap_swap(self, index, self->length - 1);
+    self->length -= 1;
+    x__heap_handle_destroy(self, handle);
+    if (index < self->length) {
+        long moved = self->handle[index];
+        x__heap_sift_up(self, index, context);
+        if (self->index[moved] == index) {
+            x__heap_sift_down(self, index, context);
+        }
+    }
+    return x__heap_data(self, x__heap_slot(self, self->length));
+}
+
+/**
+ * @brief Create a new heap from an array of item data
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param compare Pointer to a data comparison function
+ * @param arity Number of children per item (optional)
+ * @param data Pointer to an array of item data
+ * @param count Number of items in the array
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return New heap instance
+ * @note If `size == 0`, `data` is assumed to be an array of data pointers
+ * @note If `arity == 0`, `heap_arity` children per item are used
+ * @note The heap is built bottom-up in linear time
+ */
+static Heap heap_from_array(Arena *arena, long size, HeapDataCompare *compare, long arity,
+                            void *data, long count, void *context) {
+    Heap heap = heap_create(arena, size, compare, arity);
+    x__heap_reserve(&heap, count);
+    for (long i = 0; i < count; i++) {
+        void *item = size ? (char *)data + i * size : ((void **)data)[i];
+        x__heap_item_init(&heap, x__heap_slot(&heap, i), item);
+    }
+    heap.length = count;
+    for (long i = (count - 2) / heap.arity; count > 1 && i >= 0; i--) {
+        x__heap_sift_down(&heap, i, context);
+    }
+    return heap;
 }
 
 /**
@@ -218,14 +454,34 @@ static void *heap_peek(const Heap *self) {
  * @param arena Pointer to an arena allocator (optional)
  * @return Cloned heap instance
  * @note If no arena allocator is passed, the arena allocator of the heap is used
+ * @note The item array is copied as is, so the comparison function (and `context`) is not used
+ * @note The handles of the items in the clone are the same as in the heap
  */
-static Heap heap_clone(const Heap *self, void *context, Arena *arena) {
+static Heap heap_clone(const Heap *self, void *, Arena *arena) {
     Heap heap = {};
     heap.arena = arena ? arena : self->arena;
     heap.data = self->data;
-    heap_for_each(item, self) {
-        heap_push(&heap, item->data, context);
+    heap.arity = self->arity;
+    heap.track = self->track;
+    x__heap_reserve(&heap, self->handles > self->length ? self->handles : self->length);
+    if (self->track && self->handles) {
+        memcpy(heap.handle, self->handle, self->length * sizeof(long));
+        memcpy(heap.index, self->index, self->handles * sizeof(long));
+    }
+    heap.handles = self->handles;
+    heap.free = self->free;
+    if (!self->length) {
+        return heap;
     }
+    if (!self->data.size || self->data.copy == arena_memcpy) {
+        memcpy(x__heap_slot(&heap, 0), x__heap_slot(self, 0), self->length * x__heap_stride(self));
+    }
+    else {
+        for (long i = 0; i < self->length; i++) {
+            x__heap_item_init(&heap, x__heap_slot(&heap, i), x__heap_slot(self, i));
+        }
+    }
+    heap.length = self->length;
     return heap;
 }
 
@@ -245,3 +501,540 @@ static HeapItem *heap_items(const Heap *self, Arena *arena) {
     }
     return items;
 }
+
+/**
+ * @brief Represents a k-way merge of sorted lists and arrays
+ *
+ * The merge keeps one cursor per sorted run in a heap, so every merged item costs one sift of a
+ * heap with one item per run. Items that compare equal are returned in the order of their runs.
+ */
+struct HeapMerge {
+    Heap heap;                 ///< Heap of run cursors
+    HeapDataCompare *compare;  ///< Pointer to a data comparison function
+    void *context;             ///< Pointer to a user-provided context for the comparison function
+    long runs;                 ///< Number of added runs
+};
+
+/// @private
+typedef struct {
+    const ListItem *item;  ///< Pointer to the current list item, or `nullptr` for an array
+    const char *data;      ///< Pointer to the current array element
+    const char *end;       ///< Pointer past the last array element
+    long size;             ///< Size of the array elements in bytes, or `0` for data pointers
+    long run;              ///< Index of the run
+} X__HeapMergeRun;
+
+/// @private
+static void *x__heap_merge_data(const X__HeapMergeRun *run) {
+    if (run->item) {
+        return run->item->data;
+    }
+    return run->size ? (void *)run->data : *(void **)run->data;
+}
+
+/// @private
+static int x__heap_merge_compare(const void *_a, const void *_b, void *context) {
+    const X__HeapMergeRun *a = _a;
+    const X__HeapMergeRun *b = _b;
+    const HeapMerge *self = context;
+    int order = self->compare(x__heap_merge_data(a), x__heap_merge_data(b), self->context);
+    return order ? order : (a->run > b->run) - (a->run < b->run);
+}
+
+/**
+ * @brief Create a new k-way merge
+ * @param arena Pointer to an arena allocator
+ * @param compare Pointer to a data comparison function
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return New k-way merge instance
+ * @note The runs must be sorted with respect to `compare`
+ */
+static HeapMerge heap_merge_create(Arena *arena, HeapDataCompare *compare, void *context) {
+    HeapMerge merge = {};
+    merge.heap = heap_create(arena, sizeof(X__HeapMergeRun), x__heap_merge_compare, 0);
+    merge.compare = compare;
+    merge.context = context;
+    return merge;
+}
+
+/**
+ * @brief Add a sorted list to a k-way merge
+ * @param self Pointer to a k-way merge
+ * @param list Pointer to a sorted list
+ * @note The list must not be modified until the merge is exhausted
+ */
+static void heap_merge_list(HeapMerge *self, const List *list) {
+    X__HeapMergeRun run = {};
+    run.item = list->begin;
+    run.run = self->runs++;
+    if (run.item) {
+        heap_push(&self->heap, &run, self);
+    }
+}
+
+/**
+ * @brief Add a sorted array to a k-way merge
+ * @param self Pointer to a k-way merge
+ * @param data Pointer to a sorted array of item data
+ * @param count Number of items in the array
+ * @param size Size of item data in bytes (optional)
+ * @note If `size == 0`, `data` is assumed to be an array of data pointers
+ */
+static void heap_merge_array(HeapMerge *self, const void *data, long count, long size) {
+    X__HeapMergeRun run = {};
+    run.data = data;
+    run.size = size;
+    run.end = run.data + count * (size ? size : (long)sizeof(void *));
+    run.run = self->runs++;
+    if (count) {
+        heap_push(&self->heap, &run, self);
+    }
+}
+
+/**
+ * @brief Retrieve the next item of a k-way merge
+ * @param self Pointer to a k-way merge
+ * @return Pointer to the item data, or `nullptr` if all runs are exhausted
+ */
+static void *heap_merge_next(HeapMerge *self) {
+    X__HeapMergeRun *run = heap_peek(&self->heap);
+    if (!run) {
+        return nullptr;
+    }
+    void *data = x__heap_merge_data(run);
+    if (run->item) {
+        run->item = run->item->next;
+    }
+    else {
+        run->data += run->size ? run->size : (long)sizeof(void *);
+    }
+    if (run->item || (run->data && run->data < run->end)) {
+        x__heap_sift_down(&self->heap, 0, self);
+    }
+    else {
+        heap_pop(&self->heap, self);
+    }
+    return data;
+}
+
+/**
+ * @brief Represents a pairing heap (min-heap)
+ *
+ * The heap is a tree of individually allocated items, where every item points to its first child
+ * and to its next sibling. Insertion and melding only link two roots, so they take constant time.
+ * Popping the root pairs up its children in two passes, which takes amortized logarithmic time.
+ * If the heap stores its item data (`size != 0`), the data is stored inline after each item.
+ */
+struct PairingHeap {
+    Arena *arena;  ///< Pointer to an arena allocator
+    struct {
+        long size;                 ///< Size of the item data in bytes
+        HeapDataCompare *compare;  ///< Pointer to a data comparison function
+        HeapDataCopy *copy;        ///< Pointer to a data copy function
+    } data;                        ///< Data properties
+    long length;                   ///< Number of items in the heap
+    PairingHeapItem *root;         ///< Pointer to the root item
+};
+
+/**
+ * @brief Represents a single item in the pairing heap
+ */
+struct PairingHeapItem {
+    void *data;              ///< Pointer to the item data
+    PairingHeapItem *child;  ///< Pointer to the first child
+    PairingHeapItem *next;   ///< Pointer to the next sibling
+    PairingHeapItem *prev;   ///< Pointer to the previous sibling, or the parent for a first child
+};
+
+/**
+ * @brief Iterate over all items of a pairing heap
+ * @param item Current pairing heap item
+ * @param self Pointer to a pairing heap
+ */
+#define pairing_heap_for_each(item, self) \
+    for (auto(item) = (self)->root; item; (item) = x__pairing_heap_next(item))
+
+/**
+ * @brief Create a new pairing heap
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param compare Pointer to a data comparison function
+ * @return New pairing heap instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ */
+static PairingHeap pairing_heap_create(Arena *arena, long size, HeapDataCompare *compare) {
+    PairingHeap heap = {};
+    heap.arena = arena;
+    heap.data.size = size;
+    heap.data.compare = compare;
+    heap.data.copy = arena_memcpy;
+    return heap;
+}
+
+/// @private
+static PairingHeapItem *x__pairing_heap_next(PairingHeapItem *item) {
+    if (item->child) {
+        return item->child;
+    }
+    while (item && !item->next) {
+        while (item->prev && item->prev->child != item) {
+            item = item->prev;
+        }
+        item = item->prev;
+    }
+    return item ? item->next : nullptr;
+}
+
+/// @private
+static PairingHeapItem *x__pairing_heap_item_create(const PairingHeap *self, void *data) {
+    if (!data || !self->data.size) {
+        PairingHeapItem *item = arena_calloc(self->arena, 1, sizeof(PairingHeapItem),
+                                             alignof(PairingHeapItem));
+        item->data = data;
+        return item;
+    }
+    constexpr long offset = (sizeof(PairingHeapItem) + alignof(max_align_t) - 1) &
+                            -alignof(max_align_t);
+    PairingHeapItem *item = arena_malloc(self->arena, 1, offset + self->data.size,
+                                         alignof(max_align_t));
+    *item = (PairingHeapItem){.data = (char *)item + offset};
+    self->data.copy(self->arena, item->data, data, self->data.size);
+    return item;
+}
+
+/// @private
+static PairingHeapItem *x__pairing_heap_link(const PairingHeap *self, PairingHeapItem *item,
+                                             PairingHeapItem *other, void *context) {
+    if (self->data.compare(other->data, item->data, context) < 0) {
+        auto swap = item;
+        item = other;
+        other = swap;
+    }
+    other->prev = item;
+    other->next = item->child;
+    if (item->child) {
+        item->child->prev = other;
+    }
+    item->child = other;
+    return item;
+}
+
+/**
+ * @brief Insert an item into a pairing heap without allocating it
+ * @param self Pointer to a pairing heap
+ * @param item Pointer to the item
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @note The item is linked as is: its memory is owned by the caller and must outlive the heap, and
+ * `item->data` must point to the item data, e.g., to the struct that embeds the item
+ */
+static void pairing_heap_push_item(PairingHeap *self, PairingHeapItem *item, void *context) {
+    item->child = nullptr;
+    item->next = nullptr;
+    item->prev = nullptr;
+    self->root = self->root ? x__pairing_heap_link(self, self->root, item, context) : item;
+    self->length += 1;
+}
+
+/**
+ * @brief Insert a new item into a pairing heap
+ * @param self Pointer to a pairing heap
+ * @param data Pointer to the item data
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ */
+static void pairing_heap_push(PairingHeap *self, void *data, void *context) {
+    pairing_heap_push_item(self, x__pairing_heap_item_create(self, data), context);
+}
+
+/**
+ * @brief Remove the root item from a pairing heap
+ * @param self Pointer to a pairing heap
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return Pointer to the item data, or `nullptr` if the heap is empty
+ */
+static void *pairing_heap_pop(PairingHeap *self, void *context) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    auto data = self->root->data;
+    PairingHeapItem *pairs = nullptr;
+    for (auto item = self->root->child; item;) {
+        auto other = item->next;
+        if (!other) {
+            item->next = pairs;
+            pairs = item;
+            break;
+        }
+        auto next = other->next;
+        item = x__pairing_heap_link(self, item, other, context);
+        item->next = pairs;
+        pairs = item;
+        item = next;
+    }
+    self->root = pairs;
+    if (pairs) {
+        for (auto item = pairs->next; item;) {
+            auto next = item->next;
+            self->root = x__pairing_heap_link(self, self->root, item, context);
+            item = next;
+        }
+        self->root->next = nullptr;
+        self->root->prev = nullptr;
+    }
+    self->length -= 1;
+    return data;
+}
+
+/**
+ * @brief Retrieve the root item data of a pairing heap
+ * @param self Pointer to a pairing heap
+ * @return Pointer to the item data, or `nullptr` if the heap is empty
+ */
+static void *pairing_heap_peek(const PairingHeap *self) {
+    return self->root ? self->root->data : nullptr;
+}
+
+/**
+ * @brief Move all items of another pairing heap into a pairing heap
+ * @param self Pointer to a pairing heap
+ * @param other Pointer to another pairing heap
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @note The items are linked rather than copied, so `other` is empty afterwards and its arena
+ * allocator must outlive `self`
+ */
+static void pairing_heap_meld(PairingHeap *self, PairingHeap *other, void *context) {
+    assert(self->data.size == other->data.size);
+    if (other->root) {
+        self->root = self->root ? x__pairing_heap_link(self, self->root, other->root, context)
+                                : other->root;
+    }
+    self->length += other->length;
+    other->root = nullptr;
+    other->length = 0;
+}
+
+/**
+ * @brief Create a clone of a pairing heap
+ * @param self Pointer to a pairing heap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Cloned pairing heap instance
+ * @note If no arena allocator is passed, the arena allocator of the pairing heap is used
+ * @note The tree is copied as is, so the comparison function is not used
+ */
+static PairingHeap pairing_heap_clone(const PairingHeap *self, Arena *arena) {
+    PairingHeap heap = {};
+    heap.arena = arena ? arena : self->arena;
+    heap.data = self->data;
+    heap.length = self->length;
+    if (!self->root) {
+        return heap;
+    }
+    heap.root = x__pairing_heap_item_create(&heap, self->root->data);
+    PairingHeapItem *item = self->root;
+    PairingHeapItem *clone = heap.root;
+    while (item) {
+        if (item->child) {
+            clone->child = x__pairing_heap_item_create(&heap, item->child->data);
+            clone->child->prev = clone;
+            item = item->child;
+            clone = clone->child;
+            continue;
+        }
+        while (item && !item->next) {
+            while (item->prev && item->prev->child != item) {
+                item = item->prev;
+                clone = clone->prev;
+            }
+            item = item->prev;
+            clone = clone->prev;
+        }
+        if (item) {
+            clone->next = x__pairing_heap_item_create(&heap, item->next->data);
+            clone->next->prev = clone;
+            item = item->next;
+            clone = clone->next;
+        }
+    }
+    return heap;
+}
+
+/**
+ * @brief Represents a monotone radix heap with unsigned integer keys (min-heap)
+ *
+ * An item is stored in the bucket given by the highest bit in which its key differs from the key
+ * of the last popped item. When the lowest bucket runs empty, the next non-empty bucket is
+ * redistributed into the buckets below it, and every item moves down at most 64 times. The keys
+ * must be monotone: no key may be smaller than the key of the last popped item. The item data is
+ * stored inline in the buckets, or, if the heap was created with `size == 0`, the data pointers
+ * are.
+ */
+struct RadixHeap {
+    Arena *arena;  ///< Pointer to an arena allocator
+    struct {
+        long size;                 ///< Size of the item data in bytes
+        HeapDataCopy *copy;        ///< Pointer to a data copy function
+    } data;                        ///< Data properties
+    long length;                   ///< Number of items in the heap
+    uint64_t last;                 ///< Key of the last popped item
+    struct {
+        long length;               ///< Number of items in the bucket
+        long capacity;             ///< Number of allocated items
+        uint64_t *key;             ///< Pointer to the key array
+        char *data;                ///< Pointer to the item data array
+    } bucket[radix_heap_buckets];  ///< Buckets of items
+};
+
+/**
+ * @brief Create a new radix heap
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @return New radix heap instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ */
+static RadixHeap radix_heap_create(Arena *arena, long size) {
+    RadixHeap heap = {};
+    heap.arena = arena;
+    heap.data.size = size;
+    heap.data.copy = arena_memcpy;
+    return heap;
+}
+
+/// @private
+static long x__radix_heap_stride(const RadixHeap *self) {
+    return self->data.size ? self->data.size : (long)sizeof(void *);
+}
+
+/// @private
+static void *x__radix_heap_slot(const RadixHeap *self, long bucket, long index) {
+    return self->bucket[bucket].data + index * x__radix_heap_stride(self);
+}
+
+/// @private
+static long x__radix_heap_append(RadixHeap *self, long index, uint64_t key) {
+    auto bucket = &self->bucket[index];
+    if (bucket->length == bucket->capacity) {
+        bucket->capacity = bucket->capacity ? 2 * bucket->capacity : 1;
+        bucket->key = arena_realloc(self->arena, bucket->key, bucket->capacity, sizeof(uint64_t),
+                                    alignof(uint64_t));
+        bucket->data = arena_realloc(self->arena, bucket->data, bucket->capacity,
+                                     x__radix_heap_stride(self), alignof(max_align_t));
+    }
+    bucket->key[bucket->length] = key;
+    return bucket->length++;
+}
+
+/// @private
+static void x__radix_heap_refill(RadixHeap *self) {
+    if (self->bucket[0].length) {
+        return;
+    }
+    long index = 1;
+    while (!self->bucket[index].length) {
+        index += 1;
+    }
+    auto bucket = &self->bucket[index];
+    uint64_t last = bucket->key[0];
+    for (long i = 1; i < bucket->length; i++) {
+        last = bucket->key[i] < last ? bucket->key[i] : last;
+    }
+    long stride = x__radix_heap_stride(self);
+    for (long i = 0; i < bucket->length; i++) {
+        long target = stdc_bit_width(bucket->key[i] ^ last);
+        long slot = x__radix_heap_append(self, target, bucket->key[i]);
+        memcpy(x__radix_heap_slot(self, target, slot), x__radix_heap_slot(self, index, i), stride);
+    }
+    bucket->length = 0;
+    self->last = last;
+}
+
+/**
+ * @brief Insert a new item into a radix heap
+ * @param self Pointer to a radix heap
+ * @param key Key of the item
+ * @param data Pointer to the item data
+ * @note `key` must not be smaller than the key of the last popped item
+ */
+static void radix_heap_push(RadixHeap *self, uint64_t key, void *data) {
+    assert(key >= self->last);
+    long index = stdc_bit_width(key ^ self->last);
+    auto slot = x__radix_heap_slot(self, index, x__radix_heap_append(self, index, key));
+    if (data && self->data.size) {
+        self->data.copy(self->arena, slot, data, self->data.size);
+    }
+    else if (self->data.size) {
+        memset(slot, 0, self->data.size);
+    }
+    else {
+        *(void **)slot = data;
+    }
+    self->length += 1;
+}
+
+/**
+ * @brief Remove the item with the smallest key from a radix heap
+ * @param self Pointer to a radix heap
+ * @param key Pointer to the key of the item (optional)
+ * @return Pointer to the item data, or `nullptr` if the heap is empty
+ * @note If the heap stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next insertion or removal
+ */
+static void *radix_heap_pop(RadixHeap *self, uint64_t *key) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    x__radix_heap_refill(self);
+    self->bucket[0].length -= 1;
+    self->length -= 1;
+    if (key) {
+        *key = self->last;
+    }
+    auto slot = x__radix_heap_slot(self, 0, self->bucket[0].length);
+    return self->data.size ? slot : *(void **)slot;
+}
+
+/**
+ * @brief Retrieve the item with the smallest key of a radix heap
+ * @param self Pointer to a radix heap
+ * @param key Pointer to the key of the item (optional)
+ * @return Pointer to the item data, or `nullptr` if the heap is empty
+ * @note The buckets may be redistributed, so the heap is not `const`
+ */
+static void *radix_heap_peek(RadixHeap *self, uint64_t *key) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    x__radix_heap_refill(self);
+    if (key) {
+        *key = self->last;
+    }
+    auto slot = x__radix_heap_slot(self, 0, self->bucket[0].length - 1);
+    return self->data.size ? slot : *(void **)slot;
+}
+
+/**
+ * @brief Create a clone of a radix heap
+ * @param self Pointer to a radix heap
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Cloned radix heap instance
+ * @note If no arena allocator is passed, the arena allocator of the radix heap is used
+ */
+static RadixHeap radix_heap_clone(const RadixHeap *self, Arena *arena) {
+    RadixHeap heap = radix_heap_create(arena ? arena : self->arena, self->data.size);
+    heap.data = self->data;
+    heap.last = self->last;
+    long stride = x__radix_heap_stride(self);
+    for (long index = 0; index < radix_heap_buckets; index++) {
+        auto bucket = &self->bucket[index];
+        for (long i = 0; i < bucket->length; i++) {
+            long slot = x__radix_heap_append(&heap, index, bucket->key[i]);
+            auto data = x__radix_heap_slot(self, index, i);
+            if (self->data.size) {
+                self->data.copy(heap.arena, x__radix_heap_slot(&heap, index, slot), data, stride);
+            }
+            else {
+                memcpy(x__radix_heap_slot(&heap, index, slot), data, stride);
+            }
+        }
+    }
+    heap.length = self->length;
+    return heap;
+}
@@ -0,0 +1,34 @@
+#include "hyperloglog.h"
+
+#include <stdio.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    HyperLogLog hyperloglog = hyperloglog_create(&arena, 0);
+    for (long i = 0; i < 100000; i++) {
+        hyperloglog_insert(&hyperloglog, &i, sizeof(long));
+    }
+
+    HyperLogLog clone = hyperloglog_clone(&hyperloglog, &arena);
+    for (long i = 50000; i < 150000; i++) {
+        hyperloglog_insert(&clone, &i, sizeof(long));
+    }
+
+    printf("hyperloglog.count() = %ld\n", hyperloglog_count(&hyperloglog));
+    printf("clone.count() = %ld\n", hyperloglog_count(&clone));
+
+    HyperLogLog small = hyperloglog_create(&arena, 0);
+    char *key[] = {"zero", "one", "two", "three", "four", "zero", "one", "two"};
+    for (long i = 0; i < 8; i++) {
+        hyperloglog_insert(&small, key[i], 0);
+    }
+    printf("small.count() = %ld\n", hyperloglog_count(&small));
+
+    hyperloglog_merge(&hyperloglog, &small);
+    printf("hyperloglog.merge(small).count() = %ld\n", hyperloglog_count(&hyperloglog));
+
+    arena_destroy(&arena);
+}
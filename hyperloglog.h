@@ -0,0 +1,116 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <math.h>
+#include <stdbit.h>
+#include <stddef.h>
+
+#include "arena.h"
+#include "hash.h"
+
+typedef struct HyperLogLog HyperLogLog;
+
+static constexpr long hyperloglog_precision = 14;  ///< Default number of register index bits
+
+/**
+ * @brief Represents a HyperLogLog sketch for estimating the number of unique keys
+ *
+ * The sketch uses `2^precision` registers of one byte each, independent of the number of keys. The
+ * relative standard error of the estimate is about `1.04 / sqrt(2^precision)`.
+ */
+struct HyperLogLog {
+    long precision;  ///< Number of hash bits that select a register
+    uint8_t *data;   ///< Pointer to the registers
+};
+
+/**
+ * @brief Create a new HyperLogLog sketch
+ * @param arena Pointer to an arena allocator
+ * @param precision Number of hash bits that select a register (optional)
+ * @return New HyperLogLog sketch instance
+ * @note If `precision == 0`, `hyperloglog_precision` is used (16 KiB, about 0.8% error)
+ */
+static HyperLogLog hyperloglog_create(Arena *arena, long precision) {
+    precision = precision ? precision : hyperloglog_precision;
+    assert(4 <= precision && precision <= 18);
+    HyperLogLog hyperloglog = {};
+    hyperloglog.precision = precision;
+    hyperloglog.data = arena_calloc(arena, 1L << precision, sizeof(uint8_t), alignof(uint8_t));
+    return hyperloglog;
+}
+
+/// @private
+static void x__hyperloglog_insert(HyperLogLog *self, uint64_t hash) {
+    hash = x__hash_mix(hash);
+    long index = hash >> (64 - self->precision);
+    uint64_t rest = hash << self->precision | UINT64_C(1) << (self->precision - 1);
+    uint8_t rank = stdc_leading_zeros(rest) + 1;
+    if (self->data[index] < rank) {
+        self->data[index] = rank;
+    }
+}
+
+/**
+ * @brief Insert a new key into a HyperLogLog sketch
+ * @param self Pointer to a HyperLogLog sketch
+ * @param key Pointer to the key data
+ * @param size Size of the key data in bytes (optional)
+ * @note If `size == 0`, `key` is assumed to be a null-terminated string
+ */
+static void hyperloglog_insert(HyperLogLog *self, const void *key, long size) {
+    if (!size) {
+        size = strlen(key) + 1;
+    }
+    x__hyperloglog_insert(self, x__hash_fnv1a(key, size));
+}
+
+/**
+ * @brief Estimate the number of unique keys of a HyperLogLog sketch
+ * @param self Pointer to a HyperLogLog sketch
+ * @return Estimated number of unique keys
+ */
+static long hyperloglog_count(const HyperLogLog *self) {
+    long count = 1L << self->precision;
+    double alpha = count == 16   ? 0.673
+                 : count == 32   ? 0.697
+                 : count == 64   ? 0.709
+                                 : 0.7213 / (1 + 1.079 / count);
+    double sum = 0;
+    long zeros = 0;
+    for (long i = 0; i < count; i++) {
+        sum += 1.0 / (UINT64_C(1) << self->data[i]);
+        zeros += !self->data[i];
+    }
+    double estimate = alpha * count * count / sum;
+    if (estimate <= 2.5 * count && zeros) {
+        estimate = count * log((double)count / zeros);
+    }
+    return estimate + 0.5;
+}
+
+/**
+ * @brief Add the keys of another HyperLogLog sketch to a HyperLogLog sketch
+ * @param self Pointer to a HyperLogLog sketch
+ * @param other Pointer to another HyperLogLog sketch
+ * @note Both sketches must have the same precision
+ */
+static void hyperloglog_merge(HyperLogLog *self, const HyperLogLog *other) {
+    assert(self->precision == other->precision);
+    for (long i = 0; i < 1L << self->precision; i++) {
+        self->data[i] = self->data[i] > other->data[i] ? self->data[i] : other->data[i];
+    }
+}
+
+/**
+ * @brief Create a clone of a HyperLogLog sketch
+ * @param self Pointer to a HyperLogLog sketch
+ * @param arena Pointer to an arena allocator
+ * @return Cloned HyperLogLog sketch instance
+ */
+static HyperLogLog hyperloglog_clone(const HyperLogLog *self, Arena *arena) {
+    HyperLogLog hyperloglog = *self;
+    hyperloglog.data = arena_memdup(arena, self->data, 1L << self->precision, sizeof(uint8_t),
+                                    alignof(uint8_t));
+    return hyperloglog;
+}
@@ -1,17 +1,49 @@
 #include "list.h"
 
 #include <stdio.h>
+#include <time.h>
 
 static constexpr long mega_byte = 1 << 20;
 
+static constexpr long operations = 1 << 20;
+
 int intcmp(const void *_a, const void *_b, void *) {
     const int *lhs = _a;
     const int *rhs = _b;
     return (*lhs > *rhs) - (*lhs < *rhs);
 }
 
+double now(void) {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + 1e-9 * time.tv_nsec;
+}
+
+double sort_time(Arena arena, long input, bool gather) {
+    List list = list_create(&arena, sizeof(int), intcmp);
+    uint64_t random = 0x9e3779b97f4a7c15;
+    for (int i = 0; i < operations; i++) {
+        random = 6364136223846793005 * random + 1442695040888963407;
+        int data[] = {(int)(random >> 33), i, (int)(operations - i)};
+        list_append(&list, &data[input]);
+    }
+    double start = now();
+    if (gather) {
+        list_sort_gather(&list, nullptr);
+    }
+    else {
+        list_sort(&list, nullptr);
+    }
+    return now() - start;
+}
+
+typedef struct {
+    const char *name;
+    ListItem item;
+} Task;
+
 int main(void) {
-    Arena arena = arena_create(mega_byte);
+    Arena arena = arena_create(128 * mega_byte);
 
     List list = list_create(&arena, sizeof(int), intcmp);
 
@@ -58,5 +90,46 @@ int main(void) {
     printf("list.count(33) = %ld\n", list_count(&list, (int[]){33}));
     printf("clone.count(33) = %ld\n", list_count(&clone, (int[]){33}));
 
+    List indexed = list_create(&arena, sizeof(int), intcmp);
+    list_skip(&indexed);
+    for (int i = 0; i < 1000; i++) {
+        list_insert(&indexed, indexed.length / 2, &i);
+    }
+    list_pop(&indexed, 500);
+
+    printf("indexed.get(500) = %d\n", *(int *)list_get(&indexed, 500));
+    printf("indexed.get(-1) = %d\n", *(int *)list_get(&indexed, -1));
+
+    list_sort_gather(&indexed, nullptr);
+
+    printf("sorted.get(500) = %d\n", *(int *)list_get(&indexed, 500));
+    printf("sorted.get(-1) = %d\n", *(int *)list_get(&indexed, -1));
+
+    Task task[] = {{.name = "read"}, {.name = "write"}, {.name = "close"}};
+    List tasks = list_create(&arena, 0, nullptr);
+    for (long i = 0; i < 3; i++) {
+        task[i].item.data = &task[i];
+        list_insert_item(&tasks, 0, &task[i].item);
+    }
+
+    printf("tasks = [");
+    list_for_each(item, &tasks) {
+        printf("%s, ", list_container(item, Task, item)->name);
+    }
+    printf("]\n");
+
+    List tail = list_split(&indexed, 990);
+    list_splice(&tail, 5, &list);
+    list_extend_move(&tail, &clone);
+
+    printf("tail.length = %ld, indexed.length = %ld\n", tail.length, indexed.length);
+    printf("tail.get(5) = %d\n", *(int *)list_get(&tail, 5));
+
+    const char *input[] = {"random", "sorted", "reversed"};
+    for (long i = 0; i < 3; i++) {
+        printf("%s: sort %.2f ms, gather %.2f ms\n", input[i], 1e3 * sort_time(arena, i, false),
+               1e3 * sort_time(arena, i, true));
+    }
+
     arena_destroy(&arena);
 }
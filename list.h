@@ -2,16 +2,22 @@
 #pragma once
 
 #include <assert.h>
+#include <stdbit.h>
 #include <stddef.h>
 
 #include "arena.h"
 
 typedef struct List List;
 typedef struct ListItem ListItem;
+typedef struct ListSkip ListSkip;
+typedef struct ListSkipNode ListSkipNode;
 
 typedef int ListDataCompare(const void *, const void *, void *);  ///< Data comparison function
 typedef void *ListDataCopy(Arena *, void *, const void *, long);  ///< Data copy function
 
+static constexpr long list_skip_levels = 16;  ///< Number of levels of a skip list index
+static constexpr long list_sort_run = 16;     ///< Length of the runs that are sorted by insertion
+
 /**
  * @brief Represents a doubly linked list
  */
@@ -25,6 +31,7 @@ struct List {
     long length;                   ///< Number of items in the list
     ListItem *begin;               ///< Pointer to first item of the list
     ListItem *end;                 ///< Pointer to last item of the list
+    ListSkip *skip;                ///< Pointer to a skip list index (optional)
 };
 
 /**
@@ -36,6 +43,35 @@ struct ListItem {
     ListItem *prev;  ///< Pointer to the previous item
 };
 
+/**
+ * @brief Represents a node of a skip list index
+ *
+ * A node refers to a list item and links to the next node on each of its levels, together with the
+ * number of list items that the link skips over.
+ */
+struct ListSkipNode {
+    ListItem *item;          ///< Pointer to the list item, or `nullptr` for the head
+    long height;             ///< Number of levels
+    struct {
+        ListSkipNode *next;  ///< Pointer to the next node on the level
+        long width;          ///< Distance to the next node (or past the last item)
+    } link[];                ///< Links of the levels
+};
+
+/**
+ * @brief Represents a skip list index of a list
+ *
+ * About a quarter of the list items get a node, with geometrically distributed heights, so that
+ * retrieving, inserting and removing an item by its index takes expected logarithmic time. The
+ * index is rebuilt lazily after operations that reorder the whole list.
+ */
+struct ListSkip {
+    ListSkipNode *head;                    ///< Pointer to the head node
+    ListSkipNode *free[list_skip_levels];  ///< Pointers to unused nodes of each height
+    uint64_t random;                       ///< State of the random number generator
+    bool valid;                            ///< Whether the index matches the list
+};
+
 /**
  * @brief Iterate over all items of a list
  * @param item Current list item
@@ -43,6 +79,14 @@ struct ListItem {
  */
 #define list_for_each(item, self) for (auto(item) = (self)->begin; item; (item) = (item)->next)
 
+/**
+ * @brief Retrieve the struct that embeds a list item
+ * @param item Pointer to a list item
+ * @param type Type of the struct
+ * @param member Name of the list item member of the struct
+ */
+#define list_container(item, type, member) ((type *)((char *)(item) - offsetof(type, member)))
+
 /**
  * @brief Create a new list
  * @param arena Pointer to an arena allocator
@@ -61,63 +105,259 @@ static List list_create(Arena *arena, long size, ListDataCompare *compare) {
 }
 
 /// @private
-static void x__list_item_init(const List *self, ListItem *item, void *data) {
-    if (data && self->data.size) {
-        item->data = arena_malloc(self->arena, 1, self->data.size, alignof(max_align_t));
-        self->data.copy(self->arena, item->data, data, self->data.size);
+static ListItem *x__list_item_create(const List *self, void *data) {
+    if (!data || !self->data.size) {
+        ListItem *item = arena_calloc(self->arena, 1, sizeof(ListItem), alignof(ListItem));
+        item->data = data;
+        return item;
+    }
+    constexpr long offset = (sizeof(ListItem) + alignof(max_align_t) - 1) & -alignof(max_align_t);
+    ListItem *item = arena_malloc(self->arena, 1, offset + self->data.size, alignof(max_align_t));
+    item->data = (char *)item + offset;
+    item->next = nullptr;
+    item->prev = nullptr;
+    self->data.copy(self->arena, item->data, data, self->data.size);
+    return item;
+}
+
+/// @private
+static ListSkipNode *x__list_skip_node_create(const List *self, long height) {
+    auto node = self->skip->free[height - 1];
+    if (node) {
+        self->skip->free[height - 1] = node->link[0].next;
     }
     else {
-        item->data = data;
+        node = arena_malloc(self->arena, 1, sizeof(ListSkipNode) + height * sizeof(*node->link),
+                            alignof(ListSkipNode));
+        node->height = height;
+    }
+    return node;
+}
+
+/// @private
+static long x__list_skip_height(const List *self) {
+    auto skip = self->skip;
+    skip->random ^= skip->random << 13;
+    skip->random ^= skip->random >> 7;
+    skip->random ^= skip->random << 17;
+    long height = stdc_trailing_zeros(skip->random) / 2;
+    return height < list_skip_levels ? height : list_skip_levels - 1;
+}
+
+/// @private
+static void x__list_skip_build(const List *self) {
+    auto skip = self->skip;
+    auto head = skip->head;
+    for (auto node = head->link[0].next; node;) {
+        auto next = node->link[0].next;
+        node->link[0].next = skip->free[node->height - 1];
+        skip->free[node->height - 1] = node;
+        node = next;
+    }
+    ListSkipNode *last[list_skip_levels];
+    long position[list_skip_levels];
+    for (long level = 0; level < list_skip_levels; level++) {
+        head->link[level].next = nullptr;
+        last[level] = head;
+        position[level] = -1;
+    }
+    long index = 0;
+    list_for_each(item, self) {
+        long height = x__list_skip_height(self);
+        if (height) {
+            auto node = x__list_skip_node_create(self, height);
+            node->item = item;
+            for (long level = 0; level < height; level++) {
+                last[level]->link[level].next = node;
+                last[level]->link[level].width = index - position[level];
+                last[level] = node;
+                position[level] = index;
+            }
+        }
+        index += 1;
+    }
+    for (long level = 0; level < list_skip_levels; level++) {
+        last[level]->link[level].next = nullptr;
+        last[level]->link[level].width = self->length - position[level];
+    }
+    skip->valid = true;
+}
+
+/// @private
+static void x__list_skip_find(const List *self, long index, ListSkipNode **node, long *position) {
+    auto current = self->skip->head;
+    long offset = -1;
+    for (long level = list_skip_levels - 1; level >= 0; level--) {
+        while (current->link[level].next && offset + current->link[level].width < index) {
+            offset += current->link[level].width;
+            current = current->link[level].next;
+        }
+        node[level] = current;
+        position[level] = offset;
+    }
+}
+
+/// @private
+static void x__list_skip_insert(const List *self, long index, ListItem *item) {
+    ListSkipNode *node[list_skip_levels];
+    long position[list_skip_levels];
+    x__list_skip_find(self, index, node, position);
+    long height = x__list_skip_height(self);
+    ListSkipNode *created = height ? x__list_skip_node_create(self, height) : nullptr;
+    for (long level = 0; level < list_skip_levels; level++) {
+        auto link = &node[level]->link[level];
+        if (level < height) {
+            created->item = item;
+            created->link[level].next = link->next;
+            created->link[level].width = position[level] + link->width + 1 - index;
+            link->next = created;
+            link->width = index - position[level];
+        }
+        else {
+            link->width += 1;
+        }
+    }
+}
+
+/// @private
+static void x__list_skip_remove(const List *self, long index) {
+    ListSkipNode *node[list_skip_levels];
+    long position[list_skip_levels];
+    x__list_skip_find(self, index, node, position);
+    ListSkipNode *removed = nullptr;
+    for (long level = 0; level < list_skip_levels; level++) {
+        auto link = &node[level]->link[level];
+        if (link->next && position[level] + link->width == index) {
+            removed = link->next;
+            link->width += removed->link[level].width - 1;
+            link->next = removed->link[level].next;
+        }
+        else {
+            link->width -= 1;
+        }
+    }
+    if (removed) {
+        removed->link[0].next = self->skip->free[removed->height - 1];
+        self->skip->free[removed->height - 1] = removed;
+    }
+}
+
+/// @private
+static ListItem *x__list_item(const List *self, long index) {
+    if (self->skip) {
+        if (!self->skip->valid) {
+            x__list_skip_build(self);
+        }
+        ListSkipNode *node[list_skip_levels];
+        long position[list_skip_levels];
+        x__list_skip_find(self, index, node, position);
+        auto item = node[0]->item ? node[0]->item : self->begin;
+        for (long i = node[0]->item ? position[0] : 0; i < index; i++) {
+            item = item->next;
+        }
+        return item;
+    }
+    if (index <= (self->length - 1) / 2) {
+        auto item = self->begin;
+        for (long i = 0; i < index; i++) {
+            item = item->next;
+        }
+        return item;
+    }
+    auto item = self->end;
+    for (long i = self->length - 1; i > index; i--) {
+        item = item->prev;
+    }
+    return item;
+}
+
+/// @private
+static void x__list_unlink(List *self, ListItem *item) {
+    if (item->prev) {
+        item->prev->next = item->next;
+    }
+    else {
+        self->begin = item->next;
+    }
+    if (item->next) {
+        item->next->prev = item->prev;
     }
+    else {
+        self->end = item->prev;
+    }
+    self->length -= 1;
 }
 
 /**
- * @brief Insert a new item into a list
+ * @brief Add a skip list index to a list
  * @param self Pointer to a list
- * @param index Index of the new item
- * @param data Pointer to the item data
+ * @note With the index, `list_get()`, `list_insert()` and `list_pop()` take expected logarithmic
+ * instead of linear time, at the cost of about one extra node per four items
+ * @note The index is not cloned
+ */
+static void list_skip(List *self) {
+    self->skip = arena_calloc(self->arena, 1, sizeof(ListSkip), alignof(ListSkip));
+    self->skip->head = x__list_skip_node_create(self, list_skip_levels);
+    self->skip->head->item = nullptr;
+    for (long level = 0; level < list_skip_levels; level++) {
+        self->skip->head->link[level].next = nullptr;
+    }
+    self->skip->random = 0x9e3779b97f4a7c15;
+    x__list_skip_build(self);
+}
+
+/**
+ * @brief Insert an item into a list without allocating it
+ * @param self Pointer to a list
+ * @param index Index of the item
+ * @param item Pointer to the item
  * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note The item is linked as is: its memory is owned by the caller and must outlive the list, and
+ * `item->data` should point to the item data, e.g., to the struct that embeds the item (see
+ * `list_container()`)
  */
-static void list_insert(List *self, long index, void *data) {
+static void list_insert_item(List *self, long index, ListItem *item) {
     assert(-self->length <= index && index <= self->length);
-    ListItem *item = arena_calloc(self->arena, 1, sizeof(ListItem), alignof(ListItem));
-    x__list_item_init(self, item, data);
-    if (self->length == 0) {
-        self->begin = item;
-        self->end = item;
+    if (index < 0) {
+        index += self->length;
     }
-    else if (index == 0 || index == -self->length) {
-        item->next = self->begin;
-        self->begin->prev = item;
-        self->begin = item;
-    }
-    else if (index == self->length) {
+    if (index == self->length) {
+        item->next = nullptr;
         item->prev = self->end;
-        self->end->next = item;
-        self->end = item;
     }
     else {
-        index = (self->length + index) % self->length;
-        auto next = self->begin;
-        if (index <= (self->length - 1) / 2) {
-            for (long i = 0; i < index; i++) {
-                next = next->next;
-            }
-        }
-        else {
-            next = self->end;
-            for (long i = self->length - 1; i > index; i--) {
-                next = next->prev;
-            }
-        }
-        item->next = next;
-        item->prev = next->prev;
+        item->next = index ? x__list_item(self, index) : self->begin;
+        item->prev = item->next->prev;
         item->next->prev = item;
+    }
+    if (item->prev) {
         item->prev->next = item;
     }
+    else {
+        self->begin = item;
+    }
+    if (!item->next) {
+        self->end = item;
+    }
+    if (self->skip && self->skip->valid) {
+        x__list_skip_insert(self, index, item);
+    }
     self->length += 1;
 }
 
+/**
+ * @brief Insert a new item into a list
+ * @param self Pointer to a list
+ * @param index Index of the new item
+ * @param data Pointer to the item data
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note If the list stores its item data (`size != 0`), the data is stored inline after the item,
+ * so that every item takes a single allocation
+ */
+static void list_insert(List *self, long index, void *data) {
+    list_insert_item(self, index, x__list_item_create(self, data));
+}
+
 /**
  * @brief Append a new item to the back of a list
  * @param self Pointer to a list
@@ -139,37 +379,14 @@ static void *list_pop(List *self, long index) {
         return nullptr;
     }
     assert(-self->length <= index && index < self->length);
-    auto item = self->begin;
-    if (self->length == 1) {
-        self->begin = nullptr;
-        self->end = nullptr;
-    }
-    else if (index == 0 || index == -self->length) {
-        self->begin = item->next;
-        self->begin->prev = nullptr;
+    if (index < 0) {
+        index += self->length;
     }
-    else if (index == self->length - 1 || index == -1) {
-        item = self->end;
-        self->end = item->prev;
-        self->end->next = nullptr;
-    }
-    else {
-        index = (self->length + index) % self->length;
-        if (index <= (self->length - 1) / 2) {
-            for (long i = 0; i < index; i++) {
-                item = item->next;
-            }
-        }
-        else {
-            item = self->end;
-            for (long i = self->length - 1; i > index; i--) {
-                item = item->prev;
-            }
-        }
-        item->next->prev = item->prev;
-        item->prev->next = item->next;
+    auto item = index == self->length - 1 ? self->end : x__list_item(self, index);
+    if (self->skip && self->skip->valid) {
+        x__list_skip_remove(self, index);
     }
-    self->length -= 1;
+    x__list_unlink(self, item);
     return item->data;
 }
 
@@ -182,27 +399,16 @@ static void *list_pop(List *self, long index) {
  */
 static void *list_remove(List *self, const void *data) {
     assert(self->data.compare);
+    long index = 0;
     list_for_each(item, self) {
         if (self->data.compare(item->data, data, nullptr)) {
+            index += 1;
             continue;
         }
-        if (self->length == 1) {
-            self->begin = nullptr;
-            self->end = nullptr;
-        }
-        else if (item == self->begin) {
-            self->begin = item->next;
-            self->begin->prev = nullptr;
-        }
-        else if (item == self->end) {
-            self->end = item->prev;
-            self->end->next = nullptr;
+        if (self->skip && self->skip->valid) {
+            x__list_skip_remove(self, index);
         }
-        else {
-            item->next->prev = item->prev;
-            item->prev->next = item->next;
-        }
-        self->length -= 1;
+        x__list_unlink(self, item);
         return item->data;
     }
     return nullptr;
@@ -220,20 +426,10 @@ static void *list_get(const List *self, long index) {
         return nullptr;
     }
     assert(-self->length <= index && index < self->length);
-    auto item = self->begin;
-    index = (self->length + index) % self->length;
-    if (index <= (self->length - 1) / 2) {
-        for (long i = 0; i < index; i++) {
-            item = item->next;
-        }
+    if (index < 0) {
+        index += self->length;
     }
-    else {
-        item = self->end;
-        for (long i = self->length - 1; i > index; i--) {
-            item = item->prev;
-        }
-    }
-    return item->data;
+    return x__list_item(self, index)->data;
 }
 
 /**
@@ -290,56 +486,165 @@ static long list_count(const List *self, const void *data) {
     return count;
 }
 
-/// @private
-static ListItem *x__list_merge_sort_split(ListItem *first) {
-    auto slow = first;
-    auto fast = first;
-    while (fast && fast->next && fast->next->next) {
-        slow = slow->next;
-        fast = fast->next->next;
+/**
+ * @brief Move all items of another list into a list
+ * @param self Pointer to a list
+ * @param index Index of the first moved item
+ * @param other Pointer to another list
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note The items are linked rather than copied, so `other` is empty afterwards and its arena
+ * allocator must outlive `self`; finding the position takes linear time without a skip list index,
+ * and the skip list indices of both lists are rebuilt on their next use
+ * @note `other` must be a different list than `self`
+ */
+static void list_splice(List *self, long index, List *other) {
+    assert(self != other);
+    assert(self->data.size == other->data.size);
+    assert(-self->length <= index && index <= self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    if (other->length == 0) {
+        return;
     }
-    auto second = slow->next;
-    slow->next = nullptr;
-    if (second) {
-        second->prev = nullptr;
+    ListItem *next = nullptr;
+    if (index < self->length) {
+        next = index ? x__list_item(self, index) : self->begin;
+    }
+    ListItem *prev = next ? next->prev : self->end;
+    other->begin->prev = prev;
+    other->end->next = next;
+    if (prev) {
+        prev->next = other->begin;
+    }
+    else {
+        self->begin = other->begin;
+    }
+    if (next) {
+        next->prev = other->end;
+    }
+    else {
+        self->end = other->end;
+    }
+    self->length += other->length;
+    if (self->skip) {
+        self->skip->valid = false;
+    }
+    other->begin = nullptr;
+    other->end = nullptr;
+    other->length = 0;
+    if (other->skip) {
+        other->skip->valid = false;
     }
-    return second;
+}
+
+/**
+ * @brief Move all items of another list to the back of a list
+ * @param self Pointer to a list
+ * @param other Pointer to another list
+ * @note The items are linked rather than copied in constant time (see `list_splice()`)
+ * @note `other` must be a different list than `self`
+ */
+static void list_extend_move(List *self, List *other) {
+    list_splice(self, self->length, other);
+}
+
+/**
+ * @brief Split a list into two at an index
+ * @param self Pointer to a list
+ * @param index Index of the first item of the new list
+ * @return New list instance with the items from `index` to the back of the list
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note The items are linked rather than copied, and the new list uses the arena allocator of the
+ * list; finding the position takes linear time without a skip list index, and the skip list index
+ * is rebuilt on its next use and not shared with the new list
+ */
+static List list_split(List *self, long index) {
+    assert(-self->length <= index && index <= self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    List list = {};
+    list.arena = self->arena;
+    list.data = self->data;
+    if (index == self->length) {
+        return list;
+    }
+    auto item = index ? x__list_item(self, index) : self->begin;
+    list.begin = item;
+    list.end = self->end;
+    list.length = self->length - index;
+    self->end = item->prev;
+    if (self->end) {
+        self->end->next = nullptr;
+    }
+    else {
+        self->begin = nullptr;
+    }
+    item->prev = nullptr;
+    self->length = index;
+    if (self->skip) {
+        self->skip->valid = false;
+    }
+    return list;
+}
+
+/// @private
+static ListItem *x__list_sort_merge(const List *self, ListItem *lhs, ListItem *rhs,
+                                    void *context) {
+    ListItem head = {};
+    auto tail = &head;
+    while (lhs && rhs) {
+        if (self->data.compare(rhs->data, lhs->data, context) < 0) {
+            tail->next = rhs;
+            rhs = rhs->next;
+        }
+        else {
+            tail->next = lhs;
+            lhs = lhs->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = lhs ? lhs : rhs;
+    return head.next;
 }
 
 /// @private
-static ListItem *x__list_merge_sort_merge(List *self, ListItem *first, ListItem *second,
-                                          void *context) {
-    if (!first) {
-        return second;
-    }
-    if (!second) {
-        return first;
-    }
-    if (self->data.compare(first->data, second->data, context) < 0) {
-        first->next = x__list_merge_sort_merge(self, first->next, second, context);
-        if (first->next) {
-            first->next->prev = first;
+static ListItem *x__list_sort_run(const List *self, ListItem **item, void *context) {
+    auto run = *item;
+    auto next = run->next;
+    if (next && self->data.compare(next->data, run->data, context) < 0) {
+        run->next = nullptr;
+        while (next && self->data.compare(next->data, run->data, context) < 0) {
+            auto after = next->next;
+            next->next = run;
+            run = next;
+            next = after;
         }
-        first->prev = nullptr;
-        return first;
+        *item = next;
+        return run;
     }
-    second->next = x__list_merge_sort_merge(self, first, second->next, context);
-    if (second->next) {
-        second->next->prev = second;
+    auto end = run;
+    while (end->next && self->data.compare(end->next->data, end->data, context) >= 0) {
+        end = end->next;
     }
-    second->prev = nullptr;
-    return second;
+    *item = end->next;
+    end->next = nullptr;
+    return run;
 }
 
 /// @private
-static ListItem *x__list_merge_sort(List *self, ListItem *first, void *context) {
-    if (!first || !first->next) {
-        return first;
+static void x__list_relink(List *self, ListItem *first) {
+    ListItem *prev = nullptr;
+    for (auto item = first; item; item = item->next) {
+        item->prev = prev;
+        prev = item;
+    }
+    self->begin = first;
+    self->end = prev;
+    if (self->skip) {
+        self->skip->valid = false;
     }
-    auto second = x__list_merge_sort_split(first);
-    first = x__list_merge_sort(self, first, context);
-    second = x__list_merge_sort(self, second, context);
-    return x__list_merge_sort_merge(self, first, second, context);
 }
 
 /**
@@ -347,15 +652,101 @@ static ListItem *x__list_merge_sort(List *self, ListItem *first, void *context)
  * @param self Pointer to a list
  * @param context Pointer to a user-provided context for the comparison function (optional)
  * @note This function requires a data comparison function to be set
+ * @note The sort is a stable, bottom-up merge sort of the ascending and strictly descending runs
+ * that already exist in the list, so nearly sorted (or reversed) lists take close to linear time
  */
 static void list_sort(List *self, void *context) {
     assert(self->data.compare);
-    self->begin = x__list_merge_sort(self, self->begin, context);
-    auto item = self->begin;
-    while (item && item->next) {
-        item = item->next;
+    ListItem *pending[64] = {};
+    for (auto item = self->begin; item;) {
+        auto run = x__list_sort_run(self, &item, context);
+        long level = 0;
+        while (pending[level]) {
+            run = x__list_sort_merge(self, pending[level], run, context);
+            pending[level] = nullptr;
+            level += 1;
+        }
+        pending[level] = run;
+    }
+    ListItem *first = nullptr;
+    for (long level = 0; level < 64; level++) {
+        if (pending[level]) {
+            first = first ? x__list_sort_merge(self, pending[level], first, context) : pending[level];
+        }
+    }
+    x__list_relink(self, first);
+}
+
+/// @private
+static void x__list_gather_merge(const List *self, ListItem **dest, ListItem **lhs,
+                                 ListItem **lhs_end, ListItem **rhs, ListItem **rhs_end,
+                                 void *context) {
+    while (lhs < lhs_end && rhs < rhs_end) {
+        if (self->data.compare((*rhs)->data, (*lhs)->data, context) < 0) {
+            *dest++ = *rhs++;
+        }
+        else {
+            *dest++ = *lhs++;
+        }
+    }
+    while (lhs < lhs_end) {
+        *dest++ = *lhs++;
+    }
+    while (rhs < rhs_end) {
+        *dest++ = *rhs++;
     }
-    self->end = item;
+}
+
+/**
+ * @brief Sort the items of a list by gathering them into a contiguous array
+ * @param self Pointer to a list
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @note This function requires a data comparison function to be set
+ * @note The item pointers are sorted in a temporary array at the end of the arena, which is
+ * released when the function returns, and the list is relinked afterwards; this avoids chasing
+ * the links of scattered items during the merge passes
+ */
+static void list_sort_gather(List *self, void *context) {
+    assert(self->data.compare);
+    if (self->length < 2) {
+        return;
+    }
+    Arena scratch = *self->arena;
+    ListItem **items = arena_malloc(&scratch, 2 * self->length, sizeof(ListItem *),
+                                    alignof(ListItem *));
+    ListItem **buffer = items + self->length;
+    long length = 0;
+    list_for_each(item, self) {
+        items[length++] = item;
+    }
+    for (long begin = 0; begin < length; begin += list_sort_run) {
+        long end = length - begin < list_sort_run ? length : begin + list_sort_run;
+        for (long i = begin + 1; i < end; i++) {
+            auto item = items[i];
+            long j = i;
+            while (j > begin && self->data.compare(items[j - 1]->data, item->data, context) > 0) {
+                items[j] = items[j - 1];
+                j -= 1;
+            }
+            items[j] = item;
+        }
+    }
+    for (long width = list_sort_run; width < length; width *= 2) {
+        for (long begin = 0; begin < length; begin += 2 * width) {
+            long middle = length - begin < width ? length : begin + width;
+            long end = length - middle < width ? length : middle + width;
+            x__list_gather_merge(self, buffer + begin, items + begin, items + middle,
+                                 items + middle, items + end, context);
+        }
+        auto swap = items;
+        items = buffer;
+        buffer = swap;
+    }
+    for (long i = 0; i + 1 < length; i++) {
+        items[i]->next = items[i + 1];
+    }
+    items[length - 1]->next = nullptr;
+    x__list_relink(self, items[0]);
 }
 
 /**
@@ -371,6 +762,9 @@ static void list_reverse(List *self) {
     auto swap = self->begin;
     self->begin = self->end;
     self->end = swap;
+    if (self->skip) {
+        self->skip->valid = false;
+    }
 }
 
 /**
@@ -379,6 +773,7 @@ static void list_reverse(List *self) {
  * @param arena Pointer to an arena allocator (optional)
  * @return Cloned list instance
  * @note If no arena allocator is passed, the arena allocator of the list is used
+ * @note The skip list index is not cloned
  */
 static List list_clone(const List *self, Arena *arena) {
     List list = {};
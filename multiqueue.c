@@ -0,0 +1,73 @@
+#include "multiqueue.h"
+
+#include <stdio.h>
+#include <time.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+static constexpr long operations = 1 << 20;
+
+int longcmp(const void *_a, const void *_b, void *) {
+    const long *lhs = _a;
+    const long *rhs = _b;
+    return (*lhs > *rhs) - (*lhs < *rhs);
+}
+
+typedef struct {
+    MultiQueue *queue;
+    long count;
+    long popped;
+} Worker;
+
+int work(void *_worker) {
+    Worker *worker = _worker;
+    long data = 0;
+    for (long i = 0; i < worker->count; i++) {
+        if (multiqueue_pop(worker->queue, &data, nullptr)) {
+            worker->popped += 1;
+            data += 1 + i % 7;
+            multiqueue_push(worker->queue, &data, nullptr);
+        }
+    }
+    return 0;
+}
+
+double now(void) {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + 1e-9 * time.tv_nsec;
+}
+
+int main(void) {
+    Arena arena = arena_create(256 * mega_byte);
+
+    for (long threads = 1; threads <= 8; threads *= 2) {
+        MultiQueue queue = multiqueue_create(&arena, sizeof(long), longcmp, 2 * threads,
+                                             8 * mega_byte);
+        for (long i = 0; i < operations / 16; i++) {
+            multiqueue_push(&queue, &i, nullptr);
+        }
+
+        thrd_t thread[8];
+        Worker worker[8] = {};
+        double start = now();
+        for (long i = 0; i < threads; i++) {
+            worker[i].queue = &queue;
+            worker[i].count = operations / threads;
+            thrd_create(&thread[i], work, &worker[i]);
+        }
+        long popped = 0;
+        for (long i = 0; i < threads; i++) {
+            thrd_join(thread[i], nullptr);
+            popped += worker[i].popped;
+        }
+        double time = now() - start;
+
+        printf("threads = %ld: popped = %ld, length = %ld, %.2f Mops/s\n", threads, popped,
+               multiqueue_length(&queue), 2e-6 * popped / time);
+
+        multiqueue_destroy(&queue, &arena);
+    }
+
+    arena_destroy(&arena);
+}
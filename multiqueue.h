@@ -0,0 +1,183 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <threads.h>
+
+#include "arena.h"
+#include "heap.h"
+
+typedef struct MultiQueue MultiQueue;
+
+static constexpr long multiqueue_count = 8;  ///< Default number of sub-heaps
+
+/// @private
+typedef struct {
+    alignas(64) mtx_t lock;  ///< Lock of the sub-heap
+    Arena arena;             ///< Arena allocator of the sub-heap
+    Heap heap;               ///< Sub-heap
+} X__MultiQueueHeap;
+
+/**
+ * @brief Represents a relaxed concurrent priority queue (min-heap)
+ *
+ * The queue consists of several sub-heaps with their own lock and arena. An insertion goes to a
+ * random sub-heap that is not locked. A removal compares the roots of two random sub-heaps and
+ * pops the smaller one, so it returns one of the smallest items, but not necessarily the smallest
+ * one. Using about two sub-heaps per thread keeps lock contention low.
+ */
+struct MultiQueue {
+    long size;                ///< Size of the item data in bytes
+    long count;               ///< Number of sub-heaps
+    X__MultiQueueHeap *heap;  ///< Pointer to the sub-heaps
+};
+
+/**
+ * @brief Create a new multiqueue
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param compare Pointer to a data comparison function
+ * @param count Number of sub-heaps (optional)
+ * @param capacity Size of the arena of every sub-heap in bytes
+ * @return New multiqueue instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ * @note If `count == 0`, `multiqueue_count` sub-heaps are used
+ * @note The arenas of the sub-heaps are scratch arenas of `arena`, so the multiqueue must be
+ * destroyed using `multiqueue_destroy()`
+ */
+static MultiQueue multiqueue_create(Arena *arena, long size, HeapDataCompare *compare, long count,
+                                    long capacity) {
+    MultiQueue queue = {};
+    queue.size = size;
+    queue.count = count ? count : multiqueue_count;
+    queue.heap = arena_calloc(arena, queue.count, sizeof(X__MultiQueueHeap),
+                              alignof(X__MultiQueueHeap));
+    for (long i = 0; i < queue.count; i++) {
+        auto heap = &queue.heap[i];
+        [[maybe_unused]] int status = mtx_init(&heap->lock, mtx_plain);
+        assert(status == thrd_success);
+        heap->arena = arena_scratch_create(arena, capacity);
+        heap->heap = heap_create(&heap->arena, size, compare, 0);
+    }
+    return queue;
+}
+
+/// @private
+static long x__multiqueue_random(long count) {
+    static thread_local uint64_t state = 0;
+    if (!state) {
+        state = (uintptr_t)&state * 0x9e3779b97f4a7c15 | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state % count;
+}
+
+/// @private
+static void x__multiqueue_pop(const MultiQueue *self, X__MultiQueueHeap *heap, void *data,
+                              void *context) {
+    void *item = heap_pop(&heap->heap, context);
+    if (self->size) {
+        memcpy(data, item, self->size);
+    }
+    else {
+        *(void **)data = item;
+    }
+    mtx_unlock(&heap->lock);
+}
+
+/**
+ * @brief Insert a new item into a multiqueue
+ * @param self Pointer to a multiqueue
+ * @param data Pointer to the item data
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @note This function is thread-safe
+ */
+static void multiqueue_push(MultiQueue *self, void *data, void *context) {
+    auto heap = &self->heap[x__multiqueue_random(self->count)];
+    for (long i = 0; mtx_trylock(&heap->lock) != thrd_success; i++) {
+        if (i == self->count) {
+            mtx_lock(&heap->lock);
+            break;
+        }
+        heap = &self->heap[x__multiqueue_random(self->count)];
+    }
+    heap_push(&heap->heap, data, context);
+    mtx_unlock(&heap->lock);
+}
+
+/**
+ * @brief Remove one of the smallest items from a multiqueue
+ * @param self Pointer to a multiqueue
+ * @param data Pointer to where the item data is copied to
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return `true` if an item was removed, or `false` if all sub-heaps are empty
+ * @note If `size == 0`, the data pointer is written to `data`
+ * @note This function is thread-safe
+ */
+static bool multiqueue_pop(MultiQueue *self, void *data, void *context) {
+    long index = x__multiqueue_random(self->count);
+    auto heap = &self->heap[index];
+    mtx_lock(&heap->lock);
+    if (self->count > 1) {
+        auto other = &self->heap[(index + 1 + x__multiqueue_random(self->count - 1)) % self->count];
+        if (mtx_trylock(&other->lock) == thrd_success) {
+            void *lhs = heap_peek(&heap->heap);
+            void *rhs = heap_peek(&other->heap);
+            if (rhs && (!lhs || heap->heap.data.compare(rhs, lhs, context) < 0)) {
+                mtx_unlock(&heap->lock);
+                heap = other;
+            }
+            else {
+                mtx_unlock(&other->lock);
+            }
+        }
+    }
+    if (heap->heap.length) {
+        x__multiqueue_pop(self, heap, data, context);
+        return true;
+    }
+    mtx_unlock(&heap->lock);
+    for (long i = 0; i < self->count; i++) {
+        heap = &self->heap[(index + i) % self->count];
+        mtx_lock(&heap->lock);
+        if (heap->heap.length) {
+            x__multiqueue_pop(self, heap, data, context);
+            return true;
+        }
+        mtx_unlock(&heap->lock);
+    }
+    return false;
+}
+
+/**
+ * @brief Get the number of items in a multiqueue
+ * @param self Pointer to a multiqueue
+ * @return Number of items
+ * @note The result is only exact if no other thread modifies the multiqueue
+ */
+static long multiqueue_length(MultiQueue *self) {
+    long length = 0;
+    for (long i = 0; i < self->count; i++) {
+        mtx_lock(&self->heap[i].lock);
+        length += self->heap[i].heap.length;
+        mtx_unlock(&self->heap[i].lock);
+    }
+    return length;
+}
+
+/**
+ * @brief Destroy a multiqueue and return the space of its sub-heaps to the parent arena
+ * @param self Pointer to a multiqueue
+ * @param arena Pointer to the arena allocator that was used to create the multiqueue
+ * @note Scratch arenas must be destroyed in inverse creation order
+ */
+static void multiqueue_destroy(MultiQueue *self, Arena *arena) {
+    for (long i = self->count - 1; i >= 0; i--) {
+        mtx_destroy(&self->heap[i].lock);
+        arena_scratch_destroy(arena, self->heap[i].arena);
+    }
+    self->count = 0;
+}
@@ -0,0 +1,104 @@
+#include "queue.h"
+
+#include <stdio.h>
+#include <time.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+static constexpr long operations = 1 << 20;
+
+typedef struct {
+    Queue *queue;
+    SegmentedQueue *segmented;
+    long count;
+    long popped;
+} Worker;
+
+int work(void *_worker) {
+    Worker *worker = _worker;
+    long data = 0;
+    for (long i = 0; i < worker->count; i++) {
+        if (worker->queue) {
+            queue_push(worker->queue, &i);
+            worker->popped += queue_pop(worker->queue, &data);
+        }
+        else {
+            segmented_queue_push(worker->segmented, &i);
+            worker->popped += segmented_queue_pop(worker->segmented, &data);
+        }
+    }
+    return 0;
+}
+
+double now(void) {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + 1e-9 * time.tv_nsec;
+}
+
+double run(Queue *queue, SegmentedQueue *segmented, long threads) {
+    thrd_t thread[8];
+    Worker worker[8] = {};
+    double start = now();
+    for (long i = 0; i < threads; i++) {
+        worker[i].queue = queue;
+        worker[i].segmented = segmented;
+        worker[i].count = operations / threads;
+        thrd_create(&thread[i], work, &worker[i]);
+    }
+    long popped = 0;
+    for (long i = 0; i < threads; i++) {
+        thrd_join(thread[i], nullptr);
+        popped += worker[i].popped;
+    }
+    return 2e-6 * popped / (now() - start);
+}
+
+int main(void) {
+    Arena arena = arena_create(256 * mega_byte);
+
+    Queue small = queue_create(&arena, sizeof(long), 4);
+    printf("small.push() = [");
+    for (long i = 0; i < 5; i++) {
+        printf("%s, ", queue_push(&small, &i) ? "true" : "false");
+    }
+    printf("]\n");
+    printf("small.length() = %ld\n", queue_length(&small));
+    long data = 0;
+    queue_pop(&small, &data);
+    queue_push(&small, &(long){4});
+    printf("small.pop() = [");
+    while (queue_pop(&small, &data)) {
+        printf("%ld, ", data);
+    }
+    printf("]\n");
+
+    SegmentedQueue segments = segmented_queue_create(&arena, sizeof(long), 3);
+    for (long i = 0; i < 8; i++) {
+        segmented_queue_push(&segments, &i);
+    }
+    printf("segments.length() = %ld\n", segmented_queue_length(&segments));
+    printf("segments.pop() = [");
+    while (segmented_queue_pop(&segments, &data)) {
+        printf("%ld, ", data);
+    }
+    printf("]\n");
+    segmented_queue_destroy(&segments);
+
+    for (long threads = 1; threads <= 8; threads *= 2) {
+        Arena scratch = arena;
+
+        Queue queue = queue_create(&scratch, sizeof(long), 1024);
+        double bounded = run(&queue, nullptr, threads);
+
+        SegmentedQueue segmented = segmented_queue_create(&scratch, sizeof(long), 0);
+        double unbounded = run(nullptr, &segmented, threads);
+
+        printf("threads = %ld: bounded %.2f Mops/s, segmented %.2f Mops/s\n", threads, bounded,
+               unbounded);
+
+        segmented_queue_destroy(&segmented);
+    }
+
+    arena_destroy(&arena);
+}
@@ -0,0 +1,344 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <threads.h>
+
+#include "arena.h"
+
+typedef struct Queue Queue;
+typedef struct SegmentedQueue SegmentedQueue;
+typedef struct X__QueueSegment X__QueueSegment;
+
+static constexpr long queue_segment = 1024;  ///< Default number of items per segment
+
+/**
+ * @brief Represents a bounded lock-free multi-producer multi-consumer queue
+ *
+ * The items are stored inline in a ring buffer of cells, or, if the queue was created with
+ * `size == 0`, the data pointers are. Every cell carries a sequence number that tells whether it is
+ * ready to be written or read at a given position, so producers and consumers only contend on the
+ * position that they advance with a compare-and-swap.
+ */
+struct Queue {
+    long size;                      ///< Size of the item data in bytes
+    long capacity;                  ///< Number of cells (power of two)
+    char *cells;                    ///< Pointer to the ring buffer of cells
+    alignas(64) atomic_long back;   ///< Position of the next insertion
+    alignas(64) atomic_long front;  ///< Position of the next removal
+};
+
+/// @private
+struct X__QueueSegment {
+    X__QueueSegment *_Atomic next;      ///< Pointer to the next segment
+    X__QueueSegment *prev;              ///< Pointer to the previous segment
+    long index;                         ///< Index of the segment
+    alignas(max_align_t) char cells[];  ///< Cells of the segment
+};
+
+/**
+ * @brief Represents an unbounded lock-free multi-producer multi-consumer queue
+ *
+ * The items are stored in a linked list of fixed-size segments. A producer reserves a position with
+ * an atomic increment, and a consumer claims a written position with a compare-and-swap. Only the
+ * allocation of a new segment takes a lock, since it uses the arena. Segments are never reused, so
+ * the memory grows with the total number of insertions until the arena is released.
+ */
+struct SegmentedQueue {
+    Arena *arena;                            ///< Pointer to an arena allocator
+    long size;                               ///< Size of the item data in bytes
+    long capacity;                           ///< Number of cells per segment
+    mtx_t *lock;                             ///< Pointer to the lock of the segment allocation
+    alignas(64) atomic_long back;            ///< Position of the next insertion
+    X__QueueSegment *_Atomic back_segment;   ///< Pointer to a recent segment of the producers
+    alignas(64) atomic_long front;           ///< Position of the next removal
+    X__QueueSegment *_Atomic front_segment;  ///< Pointer to a recent segment of the consumers
+};
+
+/// @private
+static long x__queue_stride(long size) {
+    long stride = alignof(max_align_t) + (size ? size : (long)sizeof(void *));
+    return (stride + alignof(max_align_t) - 1) & -alignof(max_align_t);
+}
+
+/// @private
+static atomic_long *x__queue_sequence(char *cell) {
+    return (atomic_long *)cell;
+}
+
+/// @private
+static void x__queue_write(char *cell, long size, void *data) {
+    cell += alignof(max_align_t);
+    if (data && size) {
+        memcpy(cell, data, size);
+    }
+    else if (size) {
+        memset(cell, 0, size);
+    }
+    else {
+        *(void **)cell = data;
+    }
+}
+
+/// @private
+static void x__queue_read(char *cell, long size, void *data) {
+    cell += alignof(max_align_t);
+    if (size) {
+        memcpy(data, cell, size);
+    }
+    else {
+        *(void **)data = *(void **)cell;
+    }
+}
+
+/**
+ * @brief Create a new bounded queue
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param capacity Maximum number of items
+ * @return New queue instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ * @note The capacity is rounded up to a power of two
+ */
+static Queue queue_create(Arena *arena, long size, long capacity) {
+    assert(capacity > 0);
+    Queue queue = {};
+    queue.size = size;
+    queue.capacity = 1;
+    while (queue.capacity < capacity) {
+        queue.capacity *= 2;
+    }
+    long stride = x__queue_stride(size);
+    queue.cells = arena_malloc(arena, queue.capacity, stride, alignof(max_align_t));
+    for (long i = 0; i < queue.capacity; i++) {
+        atomic_init(x__queue_sequence(queue.cells + i * stride), i);
+    }
+    atomic_init(&queue.back, 0);
+    atomic_init(&queue.front, 0);
+    return queue;
+}
+
+/**
+ * @brief Insert a new item at the back of a queue
+ * @param self Pointer to a queue
+ * @param data Pointer to the item data
+ * @return `true` if the item was inserted, or `false` if the queue is full
+ * @note This function is thread-safe
+ */
+static bool queue_push(Queue *self, void *data) {
+    long stride = x__queue_stride(self->size);
+    long position = atomic_load_explicit(&self->back, memory_order_relaxed);
+    while (true) {
+        auto cell = self->cells + (position & (self->capacity - 1)) * stride;
+        long sequence = atomic_load_explicit(x__queue_sequence(cell), memory_order_acquire);
+        if (sequence == position) {
+            if (atomic_compare_exchange_weak_explicit(&self->back, &position, position + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                x__queue_write(cell, self->size, data);
+                atomic_store_explicit(x__queue_sequence(cell), position + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if (sequence < position) {
+            return false;
+        }
+        else {
+            position = atomic_load_explicit(&self->back, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Remove the item at the front of a queue
+ * @param self Pointer to a queue
+ * @param data Pointer to where the item data is copied to
+ * @return `true` if an item was removed, or `false` if the queue is empty
+ * @note If `size == 0`, the data pointer is written to `data`
+ * @note This function is thread-safe; it may return `false` while the insertion of the front item
+ * is still in progress
+ */
+static bool queue_pop(Queue *self, void *data) {
+    long stride = x__queue_stride(self->size);
+    long position = atomic_load_explicit(&self->front, memory_order_relaxed);
+    while (true) {
+        auto cell = self->cells + (position & (self->capacity - 1)) * stride;
+        long sequence = atomic_load_explicit(x__queue_sequence(cell), memory_order_acquire);
+        if (sequence == position + 1) {
+            if (atomic_compare_exchange_weak_explicit(&self->front, &position, position + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                x__queue_read(cell, self->size, data);
+                atomic_store_explicit(x__queue_sequence(cell), position + self->capacity,
+                                      memory_order_release);
+                return true;
+            }
+        }
+        else if (sequence < position + 1) {
+            return false;
+        }
+        else {
+            position = atomic_load_explicit(&self->front, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Get the number of items in a queue
+ * @param self Pointer to a queue
+ * @return Number of items
+ * @note The result is only a snapshot if other threads modify the queue concurrently
+ */
+static long queue_length(Queue *self) {
+    long front = atomic_load_explicit(&self->front, memory_order_relaxed);
+    long back = atomic_load_explicit(&self->back, memory_order_relaxed);
+    return back > front ? back - front : 0;
+}
+
+/// @private
+static X__QueueSegment *x__segmented_queue_segment_create(const SegmentedQueue *self, long index) {
+    long stride = x__queue_stride(self->size);
+    X__QueueSegment *segment = arena_malloc(self->arena, 1,
+                                            sizeof(X__QueueSegment) + self->capacity * stride,
+                                            alignof(X__QueueSegment));
+    atomic_init(&segment->next, nullptr);
+    segment->prev = nullptr;
+    segment->index = index;
+    for (long i = 0; i < self->capacity; i++) {
+        atomic_init(x__queue_sequence(segment->cells + i * stride), 0);
+    }
+    return segment;
+}
+
+/// @private
+static X__QueueSegment *x__segmented_queue_grow(SegmentedQueue *self, X__QueueSegment *segment) {
+    mtx_lock(self->lock);
+    auto next = atomic_load_explicit(&segment->next, memory_order_acquire);
+    if (!next) {
+        next = x__segmented_queue_segment_create(self, segment->index + 1);
+        next->prev = segment;
+        atomic_store_explicit(&segment->next, next, memory_order_release);
+    }
+    mtx_unlock(self->lock);
+    return next;
+}
+
+/// @private
+static X__QueueSegment *x__segmented_queue_find(SegmentedQueue *self,
+                                                X__QueueSegment *_Atomic *hint, long index,
+                                                bool grow) {
+    auto start = atomic_load_explicit(hint, memory_order_acquire);
+    auto segment = start;
+    while (segment->index > index) {
+        segment = segment->prev;
+    }
+    while (segment->index < index) {
+        auto next = atomic_load_explicit(&segment->next, memory_order_acquire);
+        if (!next && !grow) {
+            return nullptr;
+        }
+        segment = next ? next : x__segmented_queue_grow(self, segment);
+    }
+    if (segment->index > start->index) {
+        atomic_compare_exchange_strong(hint, &start, segment);
+    }
+    return segment;
+}
+
+/**
+ * @brief Create a new unbounded queue
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param capacity Number of items per segment (optional)
+ * @return New segmented queue instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ * @note If `capacity == 0`, `queue_segment` items per segment are used
+ * @note New segments are allocated from `arena` while the queue is in use, so no other thread may
+ * use the arena at the same time, and the queue must be destroyed using
+ * `segmented_queue_destroy()`
+ */
+static SegmentedQueue segmented_queue_create(Arena *arena, long size, long capacity) {
+    SegmentedQueue queue = {};
+    queue.arena = arena;
+    queue.size = size;
+    queue.capacity = capacity ? capacity : queue_segment;
+    queue.lock = arena_malloc(arena, 1, sizeof(mtx_t), alignof(mtx_t));
+    [[maybe_unused]] int status = mtx_init(queue.lock, mtx_plain);
+    assert(status == thrd_success);
+    auto segment = x__segmented_queue_segment_create(&queue, 0);
+    atomic_init(&queue.back, 0);
+    atomic_init(&queue.back_segment, segment);
+    atomic_init(&queue.front, 0);
+    atomic_init(&queue.front_segment, segment);
+    return queue;
+}
+
+/**
+ * @brief Insert a new item at the back of a segmented queue
+ * @param self Pointer to a segmented queue
+ * @param data Pointer to the item data
+ * @note This function is thread-safe
+ */
+static void segmented_queue_push(SegmentedQueue *self, void *data) {
+    long stride = x__queue_stride(self->size);
+    long position = atomic_fetch_add_explicit(&self->back, 1, memory_order_relaxed);
+    auto segment = x__segmented_queue_find(self, &self->back_segment, position / self->capacity,
+                                           true);
+    auto cell = segment->cells + (position % self->capacity) * stride;
+    x__queue_write(cell, self->size, data);
+    atomic_store_explicit(x__queue_sequence(cell), position + 1, memory_order_release);
+}
+
+/**
+ * @brief Remove the item at the front of a segmented queue
+ * @param self Pointer to a segmented queue
+ * @param data Pointer to where the item data is copied to
+ * @return `true` if an item was removed, or `false` if the queue is empty
+ * @note If `size == 0`, the data pointer is written to `data`
+ * @note This function is thread-safe; it may return `false` while the insertion of the front item
+ * is still in progress
+ */
+static bool segmented_queue_pop(SegmentedQueue *self, void *data) {
+    long stride = x__queue_stride(self->size);
+    long position = atomic_load_explicit(&self->front, memory_order_relaxed);
+    while (true) {
+        auto segment = x__segmented_queue_find(self, &self->front_segment,
+                                               position / self->capacity, false);
+        if (!segment) {
+            return false;
+        }
+        auto cell = segment->cells + (position % self->capacity) * stride;
+        if (atomic_load_explicit(x__queue_sequence(cell), memory_order_acquire) != position + 1) {
+            return false;
+        }
+        if (atomic_compare_exchange_weak_explicit(&self->front, &position, position + 1,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            x__queue_read(cell, self->size, data);
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Get the number of items in a segmented queue
+ * @param self Pointer to a segmented queue
+ * @return Number of items
+ * @note The result is only a snapshot if other threads modify the queue concurrently
+ */
+static long segmented_queue_length(SegmentedQueue *self) {
+    long front = atomic_load_explicit(&self->front, memory_order_relaxed);
+    long back = atomic_load_explicit(&self->back, memory_order_relaxed);
+    return back > front ? back - front : 0;
+}
+
+/**
+ * @brief Destroy a segmented queue
+ * @param self Pointer to a segmented queue
+ * @note The segments stay allocated until the arena is released
+ */
+static void segmented_queue_destroy(SegmentedQueue *self) {
+    mtx_destroy(self->lock);
+    self->lock = nullptr;
+}
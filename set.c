@@ -54,9 +54,37 @@ int main(void) {
     Set set_xor_clone = set_symmetric_difference(&set, &clone, nullptr);
     set_print(&set_xor_clone, "set_xor_clone");
 
+    Set set_update_clone = set_clone(&set, nullptr);
+    set_update(&set_update_clone, &clone);
+    set_print(&set_update_clone, "set_update_clone");
+
+    Set set_intersection_update_clone = set_clone(&set, nullptr);
+    set_intersection_update(&set_intersection_update_clone, &clone);
+    set_print(&set_intersection_update_clone, "set_intersection_update_clone");
+
+    Set set_difference_update_clone = set_clone(&set, nullptr);
+    set_difference_update(&set_difference_update_clone, &clone);
+    set_print(&set_difference_update_clone, "set_difference_update_clone");
+
+    Set set_symmetric_difference_update_clone = set_clone(&set, nullptr);
+    set_symmetric_difference_update(&set_symmetric_difference_update_clone, &clone);
+    set_print(&set_symmetric_difference_update_clone, "set_symmetric_difference_update_clone");
+
+    printf("set.equals(clone) = %d\n", set_equals(&set, &clone));
+    set_remove(&set_or_clone, "ten", 0);
+    printf("set.equals(set_or_clone) = %d\n", set_equals(&set, &set_or_clone));
+
     printf("set.is_subset(clone) = %d\n", set_is_subset(&set, &clone));
     printf("set.is_superset(clone) = %d\n", set_is_superset(&set, &clone));
 
+    Set reuse = set_create(&arena);
+    set_insert(&reuse, "zero", 0);
+    set_insert(&reuse, "one", 0);
+    set_remove(&reuse, "zero", 0);
+    set_insert(&reuse, "one", 0);
+    set_print(&reuse, "reuse");
+    printf("reuse.length = %ld\n", reuse.length);
+
     arena_destroy(&arena);
 }
 
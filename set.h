@@ -4,6 +4,8 @@
 #include <stddef.h>
 
 #include "arena.h"
+#include "bloom.h"
+#include "hash.h"
 
 typedef struct Set Set;
 typedef struct SetItem SetItem;
@@ -19,6 +21,8 @@ struct Set {
     long length;     ///< Number of items in the set
     SetItem *begin;  ///< Pointer to the root item in the set
     SetItem *end;    ///< Pointer to the last item in the set
+    Bloom *filter;   ///< Pointer to a Bloom filter of the keys (optional)
+    uint64_t hash;   ///< Order-independent fingerprint of the keys
 };
 
 /**
@@ -28,6 +32,7 @@ struct SetItem {
     struct {
         void *data;                       ///< Pointer to the key data
         long size;                        ///< Size of the key data in bytes
+        uint64_t hash;                    ///< Hash of the key data
     } key;                                ///< Key properties
     SetItem *child[1 << set_hash_shift];  ///< Array of child items for hash traversal
     SetItem *next;                        ///< Pointer to the next item
@@ -54,26 +59,86 @@ static Set set_create(Arena *arena) {
 }
 
 /// @private
-static uint64_t x__set_hash_fnv1a(const char *key, long size) {
-    constexpr uint64_t basis = 0xcbf29ce484222325;
-    constexpr uint64_t prime = 0x00000100000001b3;
-    uint64_t hash = basis;
-    for (auto byte = key; byte < key + size; byte++) {
-        hash ^= *byte;
-        hash *= prime;
-    }
-    return hash;
+static bool x__set_key_equals(const SetItem *item, const void *key, long size, uint64_t hash) {
+    return item->key.hash == hash && item->key.size == size && !memcmp(item->key.data, key, size);
 }
 
 /// @private
-static bool x__set_key_equals(const SetItem *item, const void *key, long size) {
-    return item->key.size == size && !memcmp(item->key.data, key, size);
+static void x__set_item_init(const Set *self, SetItem *item, const void *key, long size,
+                             uint64_t hash) {
+    item->key.data = arena_memdup(self->arena, key, 1, size, alignof(max_align_t));
+    item->key.size = size;
+    item->key.hash = hash;
 }
 
 /// @private
-static void x__set_item_init(const Set *self, SetItem *item, const void *key, long size) {
-    item->key.data = arena_memdup(self->arena, key, 1, size, alignof(max_align_t));
-    item->key.size = size;
+static bool x__set_insert(Set *self, const void *key, long size, uint64_t hash) {
+    SetItem **item = &self->begin;
+    SetItem **removed = nullptr;
+    for (auto branch = hash; *item; branch <<= set_hash_shift) {
+        if (!(*item)->key.size && !removed) {
+            removed = item;
+        }
+        if (x__set_key_equals(*item, key, size, hash)) {
+            return false;
+        }
+        item = &(*item)->child[branch >> set_branch_select];
+    }
+    if (removed) {
+        item = removed;
+    }
+    else {
+        *item = arena_calloc(self->arena, 1, sizeof(SetItem), alignof(SetItem));
+        if (self->end) {
+            self->end->next = *item;
+        }
+        self->end = *item;
+    }
+    x__set_item_init(self, *item, key, size, hash);
+    if (self->filter) {
+        x__bloom_insert(self->filter, hash);
+    }
+    self->hash += x__hash_mix(hash);
+    self->length += 1;
+    return true;
+}
+
+/// @private
+static void x__set_item_remove(Set *self, SetItem *item) {
+    item->key.size = 0;
+    self->hash -= x__hash_mix(item->key.hash);
+    self->length -= 1;
+}
+
+/// @private
+static bool x__set_remove(Set *self, const void *key, long size, uint64_t hash) {
+    if (self->filter && !x__bloom_find(self->filter, hash)) {
+        return false;
+    }
+    auto item = self->begin;
+    for (auto branch = hash; item; branch <<= set_hash_shift) {
+        if (x__set_key_equals(item, key, size, hash)) {
+            x__set_item_remove(self, item);
+            return true;
+        }
+        item = item->child[branch >> set_branch_select];
+    }
+    return false;
+}
+
+/// @private
+static bool x__set_find(const Set *self, const void *key, long size, uint64_t hash) {
+    if (self->filter && !x__bloom_find(self->filter, hash)) {
+        return false;
+    }
+    auto item = self->begin;
+    for (auto branch = hash; item; branch <<= set_hash_shift) {
+        if (x__set_key_equals(item, key, size, hash)) {
+            return true;
+        }
+        item = item->child[branch >> set_branch_select];
+    }
+    return false;
 }
 
 /**
@@ -88,26 +153,7 @@ static bool set_insert(Set *self, const void *key, long size) {
     if (!size) {
         size = strlen(key) + 1;
     }
-    auto item = &self->begin;
-    for (auto hash = x__set_hash_fnv1a(key, size); *item; hash <<= set_hash_shift) {
-        if (!(*item)->key.size) {
-            break;
-        }
-        if (x__set_key_equals(*item, key, size)) {
-            return false;
-        }
-        item = &(*item)->child[hash >> set_branch_select];
-    }
-    if (!*item) {
-        *item = arena_calloc(self->arena, 1, sizeof(SetItem), alignof(SetItem));
-        if (self->end) {
-            self->end->next = *item;
-        }
-        self->end = *item;
-    }
-    x__set_item_init(self, *item, key, size);
-    self->length += 1;
-    return true;
+    return x__set_insert(self, key, size, x__hash_fnv1a(key, size));
 }
 
 /**
@@ -122,16 +168,7 @@ static bool set_remove(Set *self, const void *key, long size) {
     if (!size) {
         size = strlen(key) + 1;
     }
-    auto item = self->begin;
-    for (auto hash = x__set_hash_fnv1a(key, size); item; hash <<= set_hash_shift) {
-        if (x__set_key_equals(item, key, size)) {
-            item->key.size = 0;
-            self->length -= 1;
-            return true;
-        }
-        item = item->child[hash >> set_branch_select];
-    }
-    return false;
+    return x__set_remove(self, key, size, x__hash_fnv1a(key, size));
 }
 
 /**
@@ -146,14 +183,23 @@ static bool set_find(const Set *self, const void *key, long size) {
     if (!size) {
         size = strlen(key) + 1;
     }
-    auto item = self->begin;
-    for (auto hash = x__set_hash_fnv1a(key, size); item; hash <<= set_hash_shift) {
-        if (x__set_key_equals(item, key, size)) {
-            return true;
-        }
-        item = item->child[hash >> set_branch_select];
+    return x__set_find(self, key, size, x__hash_fnv1a(key, size));
+}
+
+/**
+ * @brief Attach a Bloom filter to a set to reject most lookups of absent keys early
+ * @param self Pointer to a set
+ * @param capacity Expected number of keys
+ * @param bits Number of bits per key (optional)
+ * @note The filter is updated by every insertion, but removed keys remain in the filter
+ * @note If `bits == 0`, the default of `bloom_create()` is used
+ */
+static void set_filter(Set *self, long capacity, long bits) {
+    self->filter = arena_malloc(self->arena, 1, sizeof(Bloom), alignof(Bloom));
+    *self->filter = bloom_create(self->arena, capacity, bits);
+    set_for_each(item, self) {
+        x__bloom_insert(self->filter, item->key.hash);
     }
-    return false;
 }
 
 /**
@@ -162,14 +208,15 @@ static bool set_find(const Set *self, const void *key, long size) {
  * @param arena Pointer to an arena allocator (optional)
  * @return Cloned set instance
  * @note If no arena allocator is passed, the arena allocator of the set is used
+ * @note The Bloom filter of the set is not cloned
  */
 static Set set_clone(const Set *self, Arena *arena) {
-    Set dict = {};
-    dict.arena = arena ? arena : self->arena;
+    Set set = {};
+    set.arena = arena ? arena : self->arena;
     set_for_each(item, self) {
-        set_insert(&dict, item->key.data, item->key.size);
+        x__set_insert(&set, item->key.data, item->key.size, item->key.hash);
     }
-    return dict;
+    return set;
 }
 
 /**
@@ -195,11 +242,15 @@ static SetItem *set_items(const Set *self, Arena *arena) {
  * @param other Pointer to another set
  * @param arena Pointer to an arena allocator (optional)
  * @return New set containing all unique items from both sets
+ * @note The larger set is cloned and the items of the smaller set are inserted into the clone
  */
 static Set set_union(const Set *self, const Set *other, Arena *arena) {
-    Set set = set_clone(self, arena);
-    set_for_each(item, other) {
-        set_insert(&set, item->key.data, item->key.size);
+    arena = arena ? arena : self->arena;
+    auto large = self->length >= other->length ? self : other;
+    auto small = self->length >= other->length ? other : self;
+    Set set = set_clone(large, arena);
+    set_for_each(item, small) {
+        x__set_insert(&set, item->key.data, item->key.size, item->key.hash);
     }
     return set;
 }
@@ -210,12 +261,15 @@ static Set set_union(const Set *self, const Set *other, Arena *arena) {
  * @param other Pointer to another set
  * @param arena Pointer to an arena allocator (optional)
  * @return New set containing items common to both sets
+ * @note The items of the smaller set are probed in the larger set
  */
 static Set set_intersection(const Set *self, const Set *other, Arena *arena) {
     Set set = set_create(arena ? arena : self->arena);
-    set_for_each(item, self) {
-        if (set_find(other, item->key.data, item->key.size)) {
-            set_insert(&set, item->key.data, item->key.size);
+    auto large = self->length >= other->length ? self : other;
+    auto small = self->length >= other->length ? other : self;
+    set_for_each(item, small) {
+        if (x__set_find(large, item->key.data, item->key.size, item->key.hash)) {
+            x__set_insert(&set, item->key.data, item->key.size, item->key.hash);
         }
     }
     return set;
@@ -229,10 +283,13 @@ static Set set_intersection(const Set *self, const Set *other, Arena *arena) {
  * @return New set containing items in the first set but not in the second
  */
 static Set set_difference(const Set *self, const Set *other, Arena *arena) {
+    if (!other->length) {
+        return set_clone(self, arena);
+    }
     Set set = set_create(arena ? arena : self->arena);
     set_for_each(item, self) {
-        if (!set_find(other, item->key.data, item->key.size)) {
-            set_insert(&set, item->key.data, item->key.size);
+        if (!x__set_find(other, item->key.data, item->key.size, item->key.hash)) {
+            x__set_insert(&set, item->key.data, item->key.size, item->key.hash);
         }
     }
     return set;
@@ -246,20 +303,123 @@ static Set set_difference(const Set *self, const Set *other, Arena *arena) {
  * @return New set containing items that are in either of the sets but not in both
  */
 static Set set_symmetric_difference(const Set *self, const Set *other, Arena *arena) {
+    if (!other->length) {
+        return set_clone(self, arena);
+    }
+    if (!self->length) {
+        return set_clone(other, arena ? arena : self->arena);
+    }
     Set set = set_create(arena ? arena : self->arena);
     set_for_each(item, self) {
-        if (!set_find(other, item->key.data, item->key.size)) {
-            set_insert(&set, item->key.data, item->key.size);
+        if (!x__set_find(other, item->key.data, item->key.size, item->key.hash)) {
+            x__set_insert(&set, item->key.data, item->key.size, item->key.hash);
         }
     }
     set_for_each(item, other) {
-        if (!set_find(self, item->key.data, item->key.size)) {
-            set_insert(&set, item->key.data, item->key.size);
+        if (!x__set_find(self, item->key.data, item->key.size, item->key.hash)) {
+            x__set_insert(&set, item->key.data, item->key.size, item->key.hash);
         }
     }
     return set;
 }
 
+/**
+ * @brief Add the items of another set to a set
+ * @param self Pointer to a set
+ * @param other Pointer to another set
+ * @note This is the in-place variant of `set_union()`
+ */
+static void set_update(Set *self, const Set *other) {
+    if (self == other) {
+        return;
+    }
+    set_for_each(item, other) {
+        x__set_insert(self, item->key.data, item->key.size, item->key.hash);
+    }
+}
+
+/**
+ * @brief Remove the items from a set that are not in another set
+ * @param self Pointer to a set
+ * @param other Pointer to another set
+ * @note This is the in-place variant of `set_intersection()`
+ */
+static void set_intersection_update(Set *self, const Set *other) {
+    if (self == other) {
+        return;
+    }
+    set_for_each(item, self) {
+        if (!x__set_find(other, item->key.data, item->key.size, item->key.hash)) {
+            x__set_item_remove(self, item);
+        }
+    }
+}
+
+/**
+ * @brief Remove the items from a set that are also in another set
+ * @param self Pointer to a set
+ * @param other Pointer to another set
+ * @note This is the in-place variant of `set_difference()`
+ */
+static void set_difference_update(Set *self, const Set *other) {
+    if (self == other) {
+        set_for_each(item, self) {
+            x__set_item_remove(self, item);
+        }
+    }
+    else if (other->length < self->length) {
+        set_for_each(item, other) {
+            x__set_remove(self, item->key.data, item->key.size, item->key.hash);
+        }
+    }
+    else {
+        set_for_each(item, self) {
+            if (x__set_find(other, item->key.data, item->key.size, item->key.hash)) {
+                x__set_item_remove(self, item);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Keep the items that are in either a set or another set but not in both
+ * @param self Pointer to a set
+ * @param other Pointer to another set
+ * @note This is the in-place variant of `set_symmetric_difference()`
+ */
+static void set_symmetric_difference_update(Set *self, const Set *other) {
+    if (self == other) {
+        set_difference_update(self, other);
+        return;
+    }
+    set_for_each(item, other) {
+        if (!x__set_remove(self, item->key.data, item->key.size, item->key.hash)) {
+            x__set_insert(self, item->key.data, item->key.size, item->key.hash);
+        }
+    }
+}
+
+/**
+ * @brief Check if two sets contain the same items
+ * @param self Pointer to a set
+ * @param other Pointer to another set
+ * @return `true` if both sets contain the same items, or `false` otherwise
+ * @note Sets with a different length or fingerprint are rejected without visiting any item
+ * @note The fingerprint `self->hash` can be used as the key of a dict of sets, but colliding sets
+ * still need to be told apart with this function
+ */
+static bool set_equals(const Set *self, const Set *other) {
+    if (self->length != other->length || self->hash != other->hash) {
+        return false;
+    }
+    set_for_each(item, self) {
+        if (!x__set_find(other, item->key.data, item->key.size, item->key.hash)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Check if one set is a subset of another
  * @param self Pointer to a set
@@ -267,8 +427,11 @@ static Set set_symmetric_difference(const Set *self, const Set *other, Arena *ar
  * @return `true` if all items in the first set are also in the second, or `false` otherwise
  */
 static bool set_is_subset(const Set *self, const Set *other) {
+    if (self->length > other->length) {
+        return false;
+    }
     set_for_each(item, self) {
-        if (!set_find(other, item->key.data, item->key.size)) {
+        if (!x__set_find(other, item->key.data, item->key.size, item->key.hash)) {
             return false;
         }
     }
@@ -0,0 +1,85 @@
+#include "sort.h"
+
+#include <stdio.h>
+
+#include "dict.h"
+
+static constexpr long mega_byte = 1 << 20;
+
+#define countof(A) ((long)(sizeof(A) / sizeof(*(A))))
+
+int intcmp(const void *_a, const void *_b, void *) {
+    const int *lhs = _a;
+    const int *rhs = _b;
+    return (*lhs > *rhs) - (*lhs < *rhs);
+}
+
+uint64_t intkey(const void *_a, void *) {
+    const int *a = _a;
+    return (uint64_t)*a ^ (UINT64_C(1) << 63);
+}
+
+uint64_t dictkey(const void *_a, void *) {
+    const DictItem *a = _a;
+    return *(int *)a->data;
+}
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    int array[] = {3, -1, 4, -1, 5, -9, 2, 6, -5, 3};
+    sort_radix(array, countof(array), sizeof(int), intkey, nullptr, arena);
+
+    printf("a = [");
+    for (long i = 0; i < countof(array); i++) {
+        printf("%d, ", array[i]);
+    }
+    printf("]\n");
+
+    List list = list_create(&arena, sizeof(int), intcmp);
+    for (int i = 0; i < 10; i++) {
+        list_append(&list, &(int){(7 * i) % 10 - 5});
+    }
+    list_radix_sort(&list, intkey, nullptr);
+
+    printf("b = [");
+    list_for_each(item, &list) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    Dict dict = dict_create(&arena, sizeof(int));
+    char *key[] = {"zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine"};
+    for (long i = 0; i < countof(key); i++) {
+        dict_insert(&dict, key[i], 0, &(int){(3 * i) % 10});
+    }
+    auto items = dict_items(&dict, nullptr);
+    sort_radix(items, dict.length, sizeof(*items), dictkey, nullptr, arena);
+
+    printf("c = {");
+    for (auto item = items; item < items + dict.length; item++) {
+        printf("%s: %d, ", (char *)item->key.data, *(int *)item->data);
+    }
+    printf("}\n");
+
+    int numbers[1000];
+    for (long i = 0; i < countof(numbers); i++) {
+        numbers[i] = (int)((i * 7919) % countof(numbers)) - 500;
+    }
+    sort_parallel(numbers, countof(numbers), sizeof(int), intcmp, nullptr, 4, arena);
+
+    printf("d = [%d, %d, %d, ..., %d]\n", numbers[0], numbers[1], numbers[2],
+           numbers[countof(numbers) - 1]);
+
+    List clone = list_clone(&list, nullptr);
+    list_reverse(&clone);
+    list_parallel_sort(&clone, nullptr, 2);
+
+    printf("e = [");
+    list_for_each(item, &clone) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    arena_destroy(&arena);
+}
@@ -0,0 +1,387 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <threads.h>
+
+#include "arena.h"
+#include "list.h"
+
+typedef uint64_t SortDataKey(const void *, void *);            ///< Key extraction function
+typedef int SortDataCompare(const void *, const void *, void *);  ///< Data comparison function
+
+static constexpr long sort_threads = 4;  ///< Default number of threads of a parallel sort
+static constexpr long sort_run = 16;     ///< Length of the runs that are sorted by insertion
+
+/// @private
+typedef struct {
+    uint64_t key;  ///< Sort key of the item
+    long index;    ///< Index of the item
+} X__SortEntry;
+
+/// @private
+static X__SortEntry *x__sort_radix(X__SortEntry *entry, long count, Arena scratch) {
+    constexpr long radix = 1 << 8;
+    constexpr long passes = 64 / 8;
+    X__SortEntry *buffer = arena_malloc(&scratch, count, sizeof(X__SortEntry),
+                                        alignof(X__SortEntry));
+    long(*offset)[radix] = arena_calloc(&scratch, passes, sizeof(*offset), alignof(long));
+    for (long i = 0; i < count; i++) {
+        for (long pass = 0; pass < passes; pass++) {
+            offset[pass][entry[i].key >> (8 * pass) & (radix - 1)] += 1;
+        }
+    }
+    for (long pass = 0; pass < passes; pass++) {
+        long shift = 8 * pass;
+        if (offset[pass][entry[0].key >> shift & (radix - 1)] == count) {
+            continue;
+        }
+        for (long i = 0, total = 0; i < radix; i++) {
+            long swap = offset[pass][i];
+            offset[pass][i] = total;
+            total += swap;
+        }
+        for (long i = 0; i < count; i++) {
+            buffer[offset[pass][entry[i].key >> shift & (radix - 1)]++] = entry[i];
+        }
+        auto swap = entry;
+        entry = buffer;
+        buffer = swap;
+    }
+    return entry;
+}
+
+/**
+ * @brief Sort an array by unsigned integer keys
+ * @param data Pointer to an array of item data
+ * @param count Number of items in the array
+ * @param size Size of item data in bytes (optional)
+ * @param key Pointer to a key extraction function
+ * @param context Pointer to a user-provided context for the key extraction function (optional)
+ * @param scratch Scratch arena for the temporary buffers
+ * @note If `size == 0`, `data` is assumed to be an array of data pointers, and `key` is called with
+ * the data pointers
+ * @note The sort is a stable least significant digit radix sort: the key of every item is extracted
+ * once, the keys are sorted bytewise, and the items are permuted into place once; bytes that are
+ * equal in all keys are skipped
+ * @note Signed keys can be sorted by flipping their sign bit (`(uint64_t)key ^ (UINT64_C(1) << 63)`)
+ */
+static void sort_radix(void *data, long count, long size, SortDataKey *key, void *context,
+                       Arena scratch) {
+    if (count < 2) {
+        return;
+    }
+    long stride = size ? size : (long)sizeof(void *);
+    char *items = data;
+    X__SortEntry *entry = arena_malloc(&scratch, count, sizeof(X__SortEntry),
+                                       alignof(X__SortEntry));
+    for (long i = 0; i < count; i++) {
+        void *item = items + i * stride;
+        entry[i].key = key(size ? item : *(void **)item, context);
+        entry[i].index = i;
+    }
+    char *buffer = arena_malloc(&scratch, count, stride, alignof(max_align_t));
+    entry = x__sort_radix(entry, count, scratch);
+    for (long i = 0; i < count; i++) {
+        memcpy(buffer + i * stride, items + entry[i].index * stride, stride);
+    }
+    memcpy(items, buffer, count * stride);
+}
+
+/**
+ * @brief Sort the items of a list by unsigned integer keys
+ * @param self Pointer to a list
+ * @param key Pointer to a key extraction function
+ * @param context Pointer to a user-provided context for the key extraction function (optional)
+ * @note The items are gathered into a temporary array at the end of the arena, which is released
+ * when the function returns, sorted with a stable radix sort (see `sort_radix()`), and relinked
+ */
+static void list_radix_sort(List *self, SortDataKey *key, void *context) {
+    if (self->length < 2) {
+        return;
+    }
+    Arena scratch = *self->arena;
+    ListItem **items = arena_malloc(&scratch, self->length, sizeof(ListItem *),
+                                    alignof(ListItem *));
+    X__SortEntry *entry = arena_malloc(&scratch, self->length, sizeof(X__SortEntry),
+                                       alignof(X__SortEntry));
+    long length = 0;
+    list_for_each(item, self) {
+        entry[length].key = key(item->data, context);
+        entry[length].index = length;
+        items[length++] = item;
+    }
+    entry = x__sort_radix(entry, length, scratch);
+    for (long i = 0; i + 1 < length; i++) {
+        items[entry[i].index]->next = items[entry[i + 1].index];
+    }
+    items[entry[length - 1].index]->next = nullptr;
+    x__list_relink(self, items[entry[0].index]);
+}
+
+/// @private
+typedef struct {
+    long count;                ///< Number of items in the array
+    long size;                 ///< Size of item data in bytes
+    SortDataCompare *compare;  ///< Pointer to a data comparison function
+    void *context;             ///< Pointer to a user-provided context for the comparison function
+    long threads;              ///< Number of threads
+    long width;                ///< Number of chunks per merged run, or 0 while sorting the chunks
+    char *source;              ///< Pointer to the sorted runs
+    char *dest;                ///< Pointer to the merged runs
+} X__SortParallel;
+
+/// @private
+typedef struct {
+    X__SortParallel *sort;  ///< Pointer to the shared sort state
+    long index;             ///< Index of the thread and of its chunk
+    Arena scratch;          ///< Scratch arena of the thread
+} X__SortWorker;
+
+/// @private
+static long x__sort_stride(const X__SortParallel *self) {
+    return self->size ? self->size : (long)sizeof(void *);
+}
+
+/// @private
+static void *x__sort_data(const X__SortParallel *self, const char *slot) {
+    return self->size ? (void *)slot : *(void **)slot;
+}
+
+/// @private
+static long x__sort_bound(const X__SortParallel *self, long chunk) {
+    if (chunk >= self->threads) {
+        return self->count;
+    }
+    return chunk * self->count / self->threads;
+}
+
+/// @private
+static void x__sort_insertion(const X__SortParallel *self, char *items, long count, char *swap) {
+    long stride = x__sort_stride(self);
+    for (long i = 1; i < count; i++) {
+        memcpy(swap, items + i * stride, stride);
+        long j = i;
+        while (j > 0 && self->compare(x__sort_data(self, items + (j - 1) * stride),
+                                      x__sort_data(self, swap), self->context) > 0) {
+            j -= 1;
+        }
+        memmove(items + (j + 1) * stride, items + j * stride, (i - j) * stride);
+        memcpy(items + j * stride, swap, stride);
+    }
+}
+
+/// @private
+static void x__sort_merge(const X__SortParallel *self, char *dest, const char *lhs, long lhs_count,
+                          const char *rhs, long rhs_count) {
+    long stride = x__sort_stride(self);
+    auto lhs_end = lhs + lhs_count * stride;
+    auto rhs_end = rhs + rhs_count * stride;
+    while (lhs < lhs_end && rhs < rhs_end) {
+        if (self->compare(x__sort_data(self, rhs), x__sort_data(self, lhs), self->context) < 0) {
+            memcpy(dest, rhs, stride);
+            rhs += stride;
+        }
+        else {
+            memcpy(dest, lhs, stride);
+            lhs += stride;
+        }
+        dest += stride;
+    }
+    memcpy(dest, lhs, lhs_end - lhs);
+    memcpy(dest + (lhs_end - lhs), rhs, rhs_end - rhs);
+}
+
+/// @private
+static long x__sort_split(const X__SortParallel *self, const char *lhs, long lhs_count,
+                          const char *rhs, long rhs_count, long diagonal) {
+    long stride = x__sort_stride(self);
+    long begin = diagonal > rhs_count ? diagonal - rhs_count : 0;
+    long end = diagonal < lhs_count ? diagonal : lhs_count;
+    while (begin < end) {
+        long middle = begin + (end - begin) / 2;
+        if (self->compare(x__sort_data(self, rhs + (diagonal - middle - 1) * stride),
+                          x__sort_data(self, lhs + middle * stride), self->context) < 0) {
+            end = middle;
+        }
+        else {
+            begin = middle + 1;
+        }
+    }
+    return begin;
+}
+
+/// @private
+static void x__sort_chunk(X__SortWorker *self) {
+    auto sort = self->sort;
+    long stride = x__sort_stride(sort);
+    long begin = x__sort_bound(sort, self->index);
+    long count = x__sort_bound(sort, self->index + 1) - begin;
+    char *source = sort->source + begin * stride;
+    char *buffer = arena_malloc(&self->scratch, count + 1, stride, alignof(max_align_t));
+    for (long i = 0; i < count; i += sort_run) {
+        long run = count - i < sort_run ? count - i : sort_run;
+        x__sort_insertion(sort, source + i * stride, run, buffer + count * stride);
+    }
+    for (long width = sort_run; width < count; width *= 2) {
+        for (long i = 0; i < count; i += 2 * width) {
+            long lhs_count = count - i < width ? count - i : width;
+            long rhs_count = count - i - lhs_count < width ? count - i - lhs_count : width;
+            x__sort_merge(sort, buffer + i * stride, source + i * stride, lhs_count,
+                          source + (i + lhs_count) * stride, rhs_count);
+        }
+        auto swap = source;
+        source = buffer;
+        buffer = swap;
+    }
+    if (source != sort->source + begin * stride) {
+        memcpy(sort->source + begin * stride, source, count * stride);
+    }
+}
+
+/// @private
+static void x__sort_chunk_merge(X__SortWorker *self) {
+    auto sort = self->sort;
+    long stride = x__sort_stride(sort);
+    long chunk = self->index - self->index % (2 * sort->width);
+    long begin = x__sort_bound(sort, chunk);
+    long middle = x__sort_bound(sort, chunk + sort->width);
+    long end = x__sort_bound(sort, chunk + 2 * sort->width);
+    auto lhs = sort->source + begin * stride;
+    auto rhs = sort->source + middle * stride;
+    long lhs_count = middle - begin;
+    long rhs_count = end - middle;
+    long first = x__sort_bound(sort, self->index) - begin;
+    long last = x__sort_bound(sort, self->index + 1) - begin;
+    long lhs_first = x__sort_split(sort, lhs, lhs_count, rhs, rhs_count, first);
+    long lhs_last = x__sort_split(sort, lhs, lhs_count, rhs, rhs_count, last);
+    x__sort_merge(sort, sort->dest + (begin + first) * stride, lhs + lhs_first * stride,
+                  lhs_last - lhs_first, rhs + (first - lhs_first) * stride,
+                  (last - lhs_last) - (first - lhs_first));
+}
+
+/// @private
+static int x__sort_work(void *_self) {
+    X__SortWorker *self = _self;
+    if (self->sort->width == 0) {
+        x__sort_chunk(self);
+    }
+    else {
+        x__sort_chunk_merge(self);
+    }
+    return 0;
+}
+
+/// @private
+static void x__sort_run_workers(X__SortWorker *worker, thrd_t *thread, long threads) {
+    for (long i = 1; i < threads; i++) {
+        [[maybe_unused]] int status = thrd_create(&thread[i], x__sort_work, &worker[i]);
+        assert(status == thrd_success);
+    }
+    x__sort_work(&worker[0]);
+    for (long i = 1; i < threads; i++) {
+        thrd_join(thread[i], nullptr);
+    }
+}
+
+/**
+ * @brief Sort an array using multiple threads
+ * @param data Pointer to an array of item data
+ * @param count Number of items in the array
+ * @param size Size of item data in bytes (optional)
+ * @param compare Pointer to a data comparison function
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @param threads Number of threads (optional)
+ * @param scratch Scratch arena for the temporary buffers
+ * @note If `size == 0`, `data` is assumed to be an array of data pointers, and `compare` is called
+ * with the data pointers
+ * @note If `threads == 0`, `sort_threads` threads are used; the calling thread is one of them
+ * @note The sort is a stable merge sort: every thread sorts one chunk of the array using its own
+ * scratch arena, which is carved from `scratch`, and the sorted chunks are merged pairwise, with
+ * every merge split evenly between the threads; the comparison function must be thread-safe
+ */
+static void sort_parallel(void *data, long count, long size, SortDataCompare *compare,
+                          void *context, long threads, Arena scratch) {
+    assert(compare);
+    if (count < 2) {
+        return;
+    }
+    threads = threads ? threads : sort_threads;
+    if (threads > count / sort_run) {
+        threads = count / sort_run ? count / sort_run : 1;
+    }
+    X__SortParallel sort = {};
+    sort.count = count;
+    sort.size = size;
+    sort.compare = compare;
+    sort.context = context;
+    sort.threads = threads;
+    sort.source = data;
+    long stride = x__sort_stride(&sort);
+    thrd_t *thread = arena_malloc(&scratch, threads, sizeof(thrd_t), alignof(thrd_t));
+    X__SortWorker *worker = arena_malloc(&scratch, threads, sizeof(X__SortWorker),
+                                         alignof(X__SortWorker));
+    sort.dest = arena_malloc(&scratch, count, stride, alignof(max_align_t));
+    for (long i = 0; i < threads; i++) {
+        long capacity = (count / threads + 2) * stride + alignof(max_align_t);
+        worker[i].sort = &sort;
+        worker[i].index = i;
+        worker[i].scratch = arena_scratch_create(&scratch, capacity);
+    }
+    x__sort_run_workers(worker, thread, threads);
+    for (sort.width = 1; sort.width < threads; sort.width *= 2) {
+        x__sort_run_workers(worker, thread, threads);
+        auto swap = sort.source;
+        sort.source = sort.dest;
+        sort.dest = swap;
+    }
+    if (sort.source != data) {
+        memcpy(data, sort.source, count * stride);
+    }
+}
+
+/// @private
+typedef struct {
+    ListDataCompare *compare;  ///< Pointer to a data comparison function
+    void *context;             ///< Pointer to a user-provided context for the comparison function
+} X__SortListCompare;
+
+/// @private
+static int x__sort_list_compare(const void *_lhs, const void *_rhs, void *_self) {
+    const X__SortListCompare *self = _self;
+    const ListItem *lhs = _lhs;
+    const ListItem *rhs = _rhs;
+    return self->compare(lhs->data, rhs->data, self->context);
+}
+
+/**
+ * @brief Sort the items of a list using multiple threads
+ * @param self Pointer to a list
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @param threads Number of threads (optional)
+ * @note This function requires a data comparison function to be set
+ * @note The items are gathered into a temporary array at the end of the arena, which is released
+ * when the function returns, sorted with a stable parallel merge sort (see `sort_parallel()`), and
+ * relinked
+ */
+static void list_parallel_sort(List *self, void *context, long threads) {
+    assert(self->data.compare);
+    if (self->length < 2) {
+        return;
+    }
+    Arena scratch = *self->arena;
+    ListItem **items = arena_malloc(&scratch, self->length, sizeof(ListItem *),
+                                    alignof(ListItem *));
+    long length = 0;
+    list_for_each(item, self) {
+        items[length++] = item;
+    }
+    X__SortListCompare compare = {self->data.compare, context};
+    sort_parallel(items, length, 0, x__sort_list_compare, &compare, threads, scratch);
+    for (long i = 0; i + 1 < length; i++) {
+        items[i]->next = items[i + 1];
+    }
+    items[length - 1]->next = nullptr;
+    x__list_relink(self, items[0]);
+}
@@ -0,0 +1,116 @@
+#include "unrolled.h"
+
+#include <stdio.h>
+#include <time.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+static constexpr long operations = 1 << 20;
+
+int intcmp(const void *_a, const void *_b, void *) {
+    const int *lhs = _a;
+    const int *rhs = _b;
+    return (*lhs > *rhs) - (*lhs < *rhs);
+}
+
+double now(void) {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + 1e-9 * time.tv_nsec;
+}
+
+int main(void) {
+    Arena arena = arena_create(128 * mega_byte);
+
+    UnrolledList list = unrolled_list_create(&arena, sizeof(int), intcmp, 4);
+
+    for (int i = 0; i < 10; i++) {
+        unrolled_list_append(&list, &i);
+    }
+
+    unrolled_list_insert(&list, 3, &(int){33});
+
+    unrolled_list_insert(&list, -3, &(int){-33});
+
+    UnrolledList clone = unrolled_list_clone(&list, nullptr);
+
+    unrolled_list_pop(&list, list.length / 2);
+
+    unrolled_list_remove(&clone, &(int){33});
+
+    printf("a = [");
+    unrolled_list_for_each(item, &list) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("b = [");
+    auto items = unrolled_list_items(&clone, nullptr);
+    for (auto item = items; item < items + clone.length; item++) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("list.get(10) = %d\n", *(int *)unrolled_list_get(&list, 10));
+    printf("clone.get(10) = %d\n", *(int *)unrolled_list_get(&clone, 10));
+
+    printf("list.index(33) = %ld\n", unrolled_list_index(&list, (int[]){33}));
+    printf("clone.index(33) = %ld\n", unrolled_list_index(&clone, (int[]){33}));
+
+    printf("list.find(33) = %p\n", unrolled_list_find(&list, (int[]){33}));
+    printf("clone.find(33) = %p\n", unrolled_list_find(&clone, (int[]){33}));
+
+    printf("list.count(33) = %ld\n", unrolled_list_count(&list, (int[]){33}));
+    printf("clone.count(33) = %ld\n", unrolled_list_count(&clone, (int[]){33}));
+
+    List linked = list_create(&arena, sizeof(int), intcmp);
+    UnrolledList unrolled = unrolled_list_create(&arena, sizeof(int), intcmp, 0);
+    for (int i = 0; i < operations; i++) {
+        list_append(&linked, &i);
+        unrolled_list_append(&unrolled, &i);
+    }
+    int last = operations - 1;
+
+    double start = now();
+    long sum = 0;
+    list_for_each(item, &linked) {
+        sum += *(int *)item->data;
+    }
+    double list_time = now() - start;
+    start = now();
+    unrolled_list_for_each(item, &unrolled) {
+        sum -= *(int *)item->data;
+    }
+    double unrolled_time = now() - start;
+    printf("for_each: list %.2f ms, unrolled %.2f ms (sum = %ld)\n", 1e3 * list_time,
+           1e3 * unrolled_time, sum);
+
+    start = now();
+    void *list_data = list_find(&linked, &last);
+    list_time = now() - start;
+    start = now();
+    void *unrolled_data = unrolled_list_find(&unrolled, &last);
+    unrolled_time = now() - start;
+    printf("find: list %.2f ms, unrolled %.2f ms (%d, %d)\n", 1e3 * list_time,
+           1e3 * unrolled_time, *(int *)list_data, *(int *)unrolled_data);
+
+    start = now();
+    long linked_index = list_index(&linked, &last);
+    list_time = now() - start;
+    start = now();
+    long unrolled_index = unrolled_list_index(&unrolled, &last);
+    unrolled_time = now() - start;
+    printf("index: list %.2f ms, unrolled %.2f ms (%ld, %ld)\n", 1e3 * list_time,
+           1e3 * unrolled_time, linked_index, unrolled_index);
+
+    start = now();
+    long linked_count = list_count(&linked, &last);
+    list_time = now() - start;
+    start = now();
+    long unrolled_count = unrolled_list_count(&unrolled, &last);
+    unrolled_time = now() - start;
+    printf("count: list %.2f ms, unrolled %.2f ms (%ld, %ld)\n", 1e3 * list_time,
+           1e3 * unrolled_time, linked_count, unrolled_count);
+
+    arena_destroy(&arena);
+}
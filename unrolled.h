@@ -0,0 +1,433 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "arena.h"
+#include "list.h"
+
+typedef struct UnrolledList UnrolledList;
+typedef struct UnrolledListNode UnrolledListNode;
+typedef struct UnrolledListItem UnrolledListItem;
+
+static constexpr long unrolled_list_bytes = 512;  ///< Default size of the item data of a node
+static constexpr long unrolled_list_min = 4;      ///< Minimum number of items per node
+
+/**
+ * @brief Represents an unrolled doubly linked list
+ *
+ * Every node stores up to `capacity` items inline and contiguously, so a traversal touches one
+ * node per `capacity` items instead of two allocations per item. The item data is stored inline,
+ * or, if the list was created with `size == 0`, the data pointers are. Since items move when other
+ * items are inserted or removed, pointers to inline item data are only valid until the next
+ * modification of the list.
+ */
+struct UnrolledList {
+    Arena *arena;  ///< Pointer to an arena allocator
+    struct {
+        long size;                 ///< Size of the item data in bytes
+        ListDataCompare *compare;  ///< Pointer to a data comparison function
+        ListDataCopy *copy;        ///< Pointer to a data copy function
+    } data;                        ///< Data properties
+    long length;                   ///< Number of items in the list
+    long capacity;                 ///< Number of items per node
+    UnrolledListNode *begin;       ///< Pointer to first node of the list
+    UnrolledListNode *end;         ///< Pointer to last node of the list
+    UnrolledListNode *free;        ///< Pointer to a list of unused nodes
+    void *scratch;                 ///< Pointer to the data of the last removed item
+};
+
+/**
+ * @brief Represents a single node of an unrolled list
+ */
+struct UnrolledListNode {
+    UnrolledListNode *next;           ///< Pointer to the next node
+    UnrolledListNode *prev;           ///< Pointer to the previous node
+    long length;                      ///< Number of items in the node
+    alignas(max_align_t) char data[];  ///< Item data of the node
+};
+
+/**
+ * @brief Represents a single item of an unrolled list
+ */
+struct UnrolledListItem {
+    void *data;              ///< Pointer to the item data
+    UnrolledListNode *node;  ///< Pointer to the node of the item
+    long offset;             ///< Offset of the item in the node
+};
+
+/**
+ * @brief Iterate over all items of an unrolled list
+ * @param item Current unrolled list item
+ * @param self Pointer to an unrolled list
+ */
+#define unrolled_list_for_each(item, self)                                                     \
+    for (UnrolledListItem item[1] = {x__unrolled_list_item(self, (self)->begin, 0)}; (item)->node; \
+         *(item) = x__unrolled_list_item(self, (item)->node, (item)->offset + 1))
+
+/**
+ * @brief Create a new unrolled list
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param compare Pointer to a data comparison function (optional)
+ * @param capacity Number of items per node (optional)
+ * @return New unrolled list instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ * @note If `capacity == 0`, as many items as fit into `unrolled_list_bytes` are stored per node,
+ * but at least `unrolled_list_min`
+ */
+static UnrolledList unrolled_list_create(Arena *arena, long size, ListDataCompare *compare,
+                                         long capacity) {
+    assert(capacity == 0 || capacity >= unrolled_list_min);
+    UnrolledList list = {};
+    list.arena = arena;
+    list.data.size = size;
+    list.data.compare = compare;
+    list.data.copy = arena_memcpy;
+    if (!capacity) {
+        capacity = unrolled_list_bytes / (size ? size : (long)sizeof(void *));
+    }
+    list.capacity = capacity < unrolled_list_min ? unrolled_list_min : capacity;
+    return list;
+}
+
+/// @private
+static long x__unrolled_list_stride(const UnrolledList *self) {
+    return self->data.size ? self->data.size : (long)sizeof(void *);
+}
+
+/// @private
+static char *x__unrolled_list_slot(const UnrolledList *self, UnrolledListNode *node, long offset) {
+    return node->data + offset * x__unrolled_list_stride(self);
+}
+
+/// @private
+static void *x__unrolled_list_data(const UnrolledList *self, void *slot) {
+    return self->data.size ? slot : *(void **)slot;
+}
+
+/// @private
+static UnrolledListItem x__unrolled_list_item(const UnrolledList *self, UnrolledListNode *node,
+                                              long offset) {
+    if (node && offset == node->length) {
+        node = node->next;
+        offset = 0;
+    }
+    UnrolledListItem item = {};
+    item.node = node;
+    item.offset = offset;
+    if (node) {
+        item.data = x__unrolled_list_data(self, x__unrolled_list_slot(self, node, offset));
+    }
+    return item;
+}
+
+/// @private
+static void x__unrolled_list_item_init(const UnrolledList *self, void *slot, void *data) {
+    if (data && self->data.size) {
+        self->data.copy(self->arena, slot, data, self->data.size);
+    }
+    else if (self->data.size) {
+        memset(slot, 0, self->data.size);
+    }
+    else {
+        *(void **)slot = data;
+    }
+}
+
+/// @private
+static UnrolledListNode *x__unrolled_list_node_create(UnrolledList *self, UnrolledListNode *prev) {
+    auto node = self->free;
+    if (node) {
+        self->free = node->next;
+    }
+    else {
+        node = arena_malloc(self->arena, 1,
+                            sizeof(UnrolledListNode) + self->capacity * x__unrolled_list_stride(self),
+                            alignof(UnrolledListNode));
+    }
+    node->length = 0;
+    node->prev = prev;
+    node->next = prev ? prev->next : self->begin;
+    if (node->prev) {
+        node->prev->next = node;
+    }
+    else {
+        self->begin = node;
+    }
+    if (node->next) {
+        node->next->prev = node;
+    }
+    else {
+        self->end = node;
+    }
+    return node;
+}
+
+/// @private
+static void x__unrolled_list_node_destroy(UnrolledList *self, UnrolledListNode *node) {
+    if (node->prev) {
+        node->prev->next = node->next;
+    }
+    else {
+        self->begin = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+    else {
+        self->end = node->prev;
+    }
+    node->next = self->free;
+    self->free = node;
+}
+
+/// @private
+static UnrolledListNode *x__unrolled_list_node(const UnrolledList *self, long *index) {
+    if (*index <= self->length / 2) {
+        auto node = self->begin;
+        while (*index >= node->length && node->next) {
+            *index -= node->length;
+            node = node->next;
+        }
+        return node;
+    }
+    auto node = self->end;
+    long offset = self->length - *index;
+    while (offset > node->length) {
+        offset -= node->length;
+        node = node->prev;
+    }
+    *index = node->length - offset;
+    return node;
+}
+
+/// @private
+static void *x__unrolled_list_erase(UnrolledList *self, UnrolledListNode *node, long offset) {
+    long stride = x__unrolled_list_stride(self);
+    auto slot = x__unrolled_list_slot(self, node, offset);
+    void *data = nullptr;
+    if (self->data.size) {
+        if (!self->scratch) {
+            self->scratch = arena_malloc(self->arena, 1, self->data.size, alignof(max_align_t));
+        }
+        data = memcpy(self->scratch, slot, stride);
+    }
+    else {
+        data = *(void **)slot;
+    }
+    memmove(slot, slot + stride, (node->length - offset - 1) * stride);
+    node->length -= 1;
+    self->length -= 1;
+    auto next = node->next;
+    if (node->length == 0) {
+        x__unrolled_list_node_destroy(self, node);
+    }
+    else if (next && node->length + next->length <= self->capacity / 2) {
+        memcpy(x__unrolled_list_slot(self, node, node->length), next->data, next->length * stride);
+        node->length += next->length;
+        x__unrolled_list_node_destroy(self, next);
+    }
+    return data;
+}
+
+/**
+ * @brief Insert a new item into an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param index Index of the new item
+ * @param data Pointer to the item data
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ */
+static void unrolled_list_insert(UnrolledList *self, long index, void *data) {
+    assert(-self->length <= index && index <= self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    if (!self->begin) {
+        x__unrolled_list_node_create(self, nullptr);
+    }
+    auto node = x__unrolled_list_node(self, &index);
+    if (node->length == self->capacity) {
+        auto next = x__unrolled_list_node_create(self, node);
+        if (index == self->capacity) {
+            index = 0;
+            node = next;
+        }
+        else {
+            next->length = node->length / 2;
+            node->length -= next->length;
+            memcpy(next->data, x__unrolled_list_slot(self, node, node->length),
+                   next->length * x__unrolled_list_stride(self));
+            if (index > node->length) {
+                index -= node->length;
+                node = next;
+            }
+        }
+    }
+    long stride = x__unrolled_list_stride(self);
+    auto slot = x__unrolled_list_slot(self, node, index);
+    memmove(slot + stride, slot, (node->length - index) * stride);
+    x__unrolled_list_item_init(self, slot, data);
+    node->length += 1;
+    self->length += 1;
+}
+
+/**
+ * @brief Append a new item to the back of an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param data Pointer to the item data
+ */
+static void unrolled_list_append(UnrolledList *self, void *data) {
+    unrolled_list_insert(self, self->length, data);
+}
+
+/**
+ * @brief Remove an item from an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param index Index of the item to remove
+ * @return Pointer to the item data, or `nullptr` if the list is empty
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note If the list stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next removal
+ */
+static void *unrolled_list_pop(UnrolledList *self, long index) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    assert(-self->length <= index && index < self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    auto node = x__unrolled_list_node(self, &index);
+    return x__unrolled_list_erase(self, node, index);
+}
+
+/**
+ * @brief Remove the first occurrence of a matching item from an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param data Pointer to the item data to match
+ * @return Pointer to the item data, or `nullptr` if no matching item is found
+ * @note This function requires a data comparison function to be set
+ * @note If the list stores its item data inline (`size != 0`), the returned pointer is only valid
+ * until the next removal
+ */
+static void *unrolled_list_remove(UnrolledList *self, const void *data) {
+    assert(self->data.compare);
+    unrolled_list_for_each(item, self) {
+        if (!self->data.compare(item->data, data, nullptr)) {
+            return x__unrolled_list_erase(self, item->node, item->offset);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Retrieve an item from an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param index Index of the item to retrieve
+ * @return Pointer to the item data, or `nullptr` if the list is empty
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ */
+static void *unrolled_list_get(const UnrolledList *self, long index) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    assert(-self->length <= index && index < self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    auto node = x__unrolled_list_node(self, &index);
+    return x__unrolled_list_data(self, x__unrolled_list_slot(self, node, index));
+}
+
+/**
+ * @brief Find the first occurrence of a matching item of an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param data Pointer to the item data to match
+ * @return Pointer to the item data, or `nullptr` if no matching item is found
+ * @note This function requires a data comparison function to be set
+ */
+static void *unrolled_list_find(const UnrolledList *self, const void *data) {
+    assert(self->data.compare);
+    unrolled_list_for_each(item, self) {
+        if (!self->data.compare(item->data, data, nullptr)) {
+            return item->data;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Retrieve the index of the first occurrence of a matching item of an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param data Pointer to the item data to match
+ * @return Index of the matching item, or `-1` if no matching item is found
+ * @note This function requires a data comparison function to be set
+ */
+static long unrolled_list_index(const UnrolledList *self, const void *data) {
+    assert(self->data.compare);
+    long index = 0;
+    unrolled_list_for_each(item, self) {
+        if (!self->data.compare(item->data, data, nullptr)) {
+            return index;
+        }
+        index += 1;
+    }
+    return -1;
+}
+
+/**
+ * @brief Count the number of matching items of an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param data Pointer to the item data to match
+ * @return Number of matching items
+ * @note This function requires a data comparison function to be set
+ */
+static long unrolled_list_count(const UnrolledList *self, const void *data) {
+    assert(self->data.compare);
+    long count = 0;
+    unrolled_list_for_each(item, self) {
+        if (!self->data.compare(item->data, data, nullptr)) {
+            count += 1;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Create a clone of an unrolled list
+ * @param self Pointer to an unrolled list
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Cloned unrolled list instance
+ * @note If no arena allocator is passed, the arena allocator of the unrolled list is used
+ * @note The nodes of the clone are filled completely
+ */
+static UnrolledList unrolled_list_clone(const UnrolledList *self, Arena *arena) {
+    UnrolledList list = {};
+    list.arena = arena ? arena : self->arena;
+    list.data = self->data;
+    list.capacity = self->capacity;
+    unrolled_list_for_each(item, self) {
+        unrolled_list_append(&list, item->data);
+    }
+    return list;
+}
+
+/**
+ * @brief Retrieve an array of unrolled list items
+ * @param self Pointer to an unrolled list
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Pointer to an array of items
+ * @note If no arena allocator is passed, the arena allocator of the unrolled list is used
+ */
+static UnrolledListItem *unrolled_list_items(const UnrolledList *self, Arena *arena) {
+    arena = arena ? arena : self->arena;
+    UnrolledListItem *items = arena_malloc(arena, self->length, sizeof(UnrolledListItem),
+                                           alignof(UnrolledListItem));
+    long index = 0;
+    unrolled_list_for_each(item, self) {
+        items[index++] = *item;
+    }
+    return items;
+}
@@ -0,0 +1,72 @@
+#include "vec.h"
+
+#include <stdio.h>
+
+static constexpr long mega_byte = 1 << 20;
+
+int intcmp(const void *_a, const void *_b, void *) {
+    const int *lhs = _a;
+    const int *rhs = _b;
+    return (*lhs > *rhs) - (*lhs < *rhs);
+}
+
+int main(void) {
+    Arena arena = arena_create(mega_byte);
+
+    Vec vec = vec_create(&arena, sizeof(int), intcmp);
+
+    for (int i = 0; i < 10; i++) {
+        vec_append(&vec, &(int){(7 * i) % 10});
+    }
+
+    vec_insert(&vec, 3, &(int){33});
+
+    vec_insert(&vec, -3, &(int){-33});
+
+    Vec clone = vec_clone(&vec, nullptr);
+
+    vec_pop(&vec, vec.length / 2);
+
+    vec_remove(&clone, &(int){33});
+
+    vec_sort(&vec, nullptr);
+
+    printf("a = [");
+    vec_for_each(item, &vec) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("b = [");
+    vec_for_each(item, &clone) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("vec.get(-1) = %d\n", *(int *)vec_get(&vec, -1));
+    printf("clone.get(-1) = %d\n", *(int *)vec_get(&clone, -1));
+
+    printf("vec.search(5) = %ld\n", vec_search(&vec, &(int){5}, nullptr));
+    printf("vec.search(10) = %ld\n", vec_search(&vec, &(int){10}, nullptr));
+
+    Vec alias = vec_create(&arena, sizeof(int), intcmp);
+    vec_reserve(&alias, 8);
+    for (int i = 0; i < 5; i++) {
+        vec_append(&alias, &i);
+    }
+    vec_insert(&alias, 0, vec_get(&alias, 3));
+    vec_append(&alias, vec_get(&alias, 0));
+    vec_append(&alias, vec_get(&alias, 0));
+    vec_append(&alias, vec_get(&alias, 0));
+
+    printf("c = [");
+    vec_for_each(item, &alias) {
+        printf("%d, ", *(int *)item->data);
+    }
+    printf("]\n");
+
+    printf("vec.find(33) = %p\n", vec_find(&vec, &(int){33}));
+    printf("clone.find(33) = %p\n", vec_find(&clone, &(int){33}));
+
+    arena_destroy(&arena);
+}
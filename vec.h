@@ -0,0 +1,384 @@
+/// @file
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+
+#include "arena.h"
+
+typedef struct Vec Vec;
+typedef struct VecItem VecItem;
+
+typedef int VecDataCompare(const void *, const void *, void *);  ///< Data comparison function
+typedef void *VecDataCopy(Arena *, void *, const void *, long);  ///< Data copy function
+
+static constexpr long vec_run = 16;  ///< Length of the runs that are sorted by insertion
+
+/**
+ * @brief Represents a dynamic array
+ *
+ * The items are stored inline in one contiguous arena allocation, or, if the vector was created
+ * with `size == 0`, the data pointers are. The array grows by doubling; if it is the last object
+ * of the arena, `arena_realloc()` grows it in place without copying. Pointers to inline item data
+ * are only valid until the next modification of the vector.
+ */
+struct Vec {
+    Arena *arena;  ///< Pointer to an arena allocator
+    struct {
+        long size;                ///< Size of the item data in bytes
+        VecDataCompare *compare;  ///< Pointer to a data comparison function
+        VecDataCopy *copy;        ///< Pointer to a data copy function
+    } data;                       ///< Data properties
+    long length;                  ///< Number of items in the vector
+    long capacity;                ///< Number of allocated items
+    char *items;                  ///< Pointer to the item array, preceded by one scratch item
+};
+
+/**
+ * @brief Represents a single item of a vector
+ */
+struct VecItem {
+    void *data;  ///< Pointer to the item data
+    long index;  ///< Index of the item in the item array
+};
+
+/**
+ * @brief Iterate over all items of a vector
+ * @param item Current vector item
+ * @param self Pointer to a vector
+ */
+#define vec_for_each(item, self)                                                   \
+    for (VecItem item[1] = {x__vec_item(self, 0)}; (item)->index < (self)->length; \
+         *(item) = x__vec_item(self, (item)->index + 1))
+
+/**
+ * @brief Create a new vector
+ * @param arena Pointer to an arena allocator
+ * @param size Size of item data in bytes (optional)
+ * @param compare Pointer to a data comparison function (optional)
+ * @return New vector instance
+ * @note If `size == 0`, the data pointers will be directly assigned rather than copied
+ */
+static Vec vec_create(Arena *arena, long size, VecDataCompare *compare) {
+    Vec vec = {};
+    vec.arena = arena;
+    vec.data.size = size;
+    vec.data.compare = compare;
+    vec.data.copy = arena_memcpy;
+    return vec;
+}
+
+/// @private
+static long x__vec_stride(const Vec *self) {
+    return self->data.size ? self->data.size : (long)sizeof(void *);
+}
+
+/// @private
+static char *x__vec_slot(const Vec *self, long index) {
+    return self->items + (index + 1) * x__vec_stride(self);
+}
+
+/// @private
+static void *x__vec_data(const Vec *self, void *slot) {
+    return self->data.size ? slot : *(void **)slot;
+}
+
+/// @private
+static VecItem x__vec_item(const Vec *self, long index) {
+    VecItem item = {};
+    item.index = index;
+    if (index < self->length) {
+        item.data = x__vec_data(self, x__vec_slot(self, index));
+    }
+    return item;
+}
+
+/// @private
+static void x__vec_item_init(const Vec *self, void *slot, void *data) {
+    if (data && self->data.size) {
+        self->data.copy(self->arena, slot, data, self->data.size);
+    }
+    else if (self->data.size) {
+        memset(slot, 0, self->data.size);
+    }
+    else {
+        *(void **)slot = data;
+    }
+}
+
+/**
+ * @brief Reserve space for a number of items in a vector
+ * @param self Pointer to a vector
+ * @param capacity Number of items
+ */
+static void vec_reserve(Vec *self, long capacity) {
+    if (capacity <= self->capacity) {
+        return;
+    }
+    self->capacity = self->capacity ? 2 * self->capacity : 1;
+    if (self->capacity < capacity) {
+        self->capacity = capacity;
+    }
+    self->items = arena_realloc(self->arena, self->items, self->capacity + 1, x__vec_stride(self),
+                                alignof(max_align_t));
+}
+
+/// @private
+static void *x__vec_grow(Vec *self, void *data) {
+    long stride = x__vec_stride(self);
+    bool inside = false;
+    if (self->data.size && data && self->items) {
+        char *end = self->items + (self->capacity + 1) * stride;
+        inside = self->items <= (char *)data && (char *)data < end;
+    }
+    if (inside) {
+        data = memmove(x__vec_slot(self, -1), data, stride);
+    }
+    vec_reserve(self, self->length + 1);
+    return inside ? x__vec_slot(self, -1) : data;
+}
+
+/**
+ * @brief Insert a new item into a vector
+ * @param self Pointer to a vector
+ * @param index Index of the new item
+ * @param data Pointer to the item data
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note `data` may point to an item of the vector itself
+ */
+static void vec_insert(Vec *self, long index, void *data) {
+    assert(-self->length <= index && index <= self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    data = x__vec_grow(self, data);
+    long stride = x__vec_stride(self);
+    auto slot = x__vec_slot(self, index);
+    memmove(slot + stride, slot, (self->length - index) * stride);
+    x__vec_item_init(self, slot, data);
+    self->length += 1;
+}
+
+/**
+ * @brief Append a new item to the back of a vector
+ * @param self Pointer to a vector
+ * @param data Pointer to the item data
+ * @note `data` may point to an item of the vector itself
+ */
+static void vec_append(Vec *self, void *data) {
+    data = x__vec_grow(self, data);
+    x__vec_item_init(self, x__vec_slot(self, self->length), data);
+    self->length += 1;
+}
+
+/**
+ * @brief Remove an item from a vector
+ * @param self Pointer to a vector
+ * @param index Index of the item to remove
+ * @return Pointer to the item data, or `nullptr` if the vector is empty
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ * @note If the vector stores its item data inline (`size != 0`), the returned pointer is only
+ * valid until the next modification
+ */
+static void *vec_pop(Vec *self, long index) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    assert(-self->length <= index && index < self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    long stride = x__vec_stride(self);
+    auto scratch = x__vec_slot(self, -1);
+    auto slot = x__vec_slot(self, index);
+    memcpy(scratch, slot, stride);
+    memmove(slot, slot + stride, (self->length - index - 1) * stride);
+    self->length -= 1;
+    return x__vec_data(self, scratch);
+}
+
+/**
+ * @brief Remove the first occurrence of a matching item from a vector
+ * @param self Pointer to a vector
+ * @param data Pointer to the item data to match
+ * @return Pointer to the item data, or `nullptr` if no matching item is found
+ * @note This function requires a data comparison function to be set
+ * @note If the vector stores its item data inline (`size != 0`), the returned pointer is only
+ * valid until the next modification
+ */
+static void *vec_remove(Vec *self, const void *data) {
+    assert(self->data.compare);
+    vec_for_each(item, self) {
+        if (!self->data.compare(item->data, data, nullptr)) {
+            return vec_pop(self, item->index);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Retrieve an item from a vector
+ * @param self Pointer to a vector
+ * @param index Index of the item to retrieve
+ * @return Pointer to the item data, or `nullptr` if the vector is empty
+ * @note A negative `index` is interpreted as from the back (`self->length - index`)
+ */
+static void *vec_get(const Vec *self, long index) {
+    if (self->length == 0) {
+        return nullptr;
+    }
+    assert(-self->length <= index && index < self->length);
+    if (index < 0) {
+        index += self->length;
+    }
+    return x__vec_data(self, x__vec_slot(self, index));
+}
+
+/**
+ * @brief Find the first occurrence of a matching item of a vector
+ * @param self Pointer to a vector
+ * @param data Pointer to the item data to match
+ * @return Pointer to the item data, or `nullptr` if no matching item is found
+ * @note This function requires a data comparison function to be set
+ */
+static void *vec_find(const Vec *self, const void *data) {
+    assert(self->data.compare);
+    vec_for_each(item, self) {
+        if (!self->data.compare(item->data, data, nullptr)) {
+            return item->data;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Find the position of an item in a sorted vector using binary search
+ * @param self Pointer to a vector
+ * @param data Pointer to the item data to search for
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @return Index of the first item that does not compare less than `data` (`self->length` if there
+ * is none)
+ * @note This function requires a data comparison function to be set
+ * @note The returned index is also the position at which `data` can be inserted to keep the vector
+ * sorted
+ */
+static long vec_search(const Vec *self, const void *data, void *context) {
+    assert(self->data.compare);
+    long begin = 0;
+    long count = self->length;
+    while (count > 0) {
+        long half = count / 2;
+        if (self->data.compare(x__vec_data(self, x__vec_slot(self, begin + half)), data, context) <
+            0) {
+            begin += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return begin;
+}
+
+/// @private
+static void x__vec_insertion_sort(const Vec *self, char *items, long count, void *context) {
+    long stride = x__vec_stride(self);
+    auto scratch = x__vec_slot(self, -1);
+    for (long i = 1; i < count; i++) {
+        memcpy(scratch, items + i * stride, stride);
+        long j = i;
+        while (j > 0 && self->data.compare(x__vec_data(self, items + (j - 1) * stride),
+                                           x__vec_data(self, scratch), context) > 0) {
+            j -= 1;
+        }
+        memmove(items + (j + 1) * stride, items + j * stride, (i - j) * stride);
+        memcpy(items + j * stride, scratch, stride);
+    }
+}
+
+/// @private
+static void x__vec_merge(const Vec *self, char *dest, const char *lhs, long lhs_count,
+                         const char *rhs, long rhs_count, void *context) {
+    long stride = x__vec_stride(self);
+    auto lhs_end = lhs + lhs_count * stride;
+    auto rhs_end = rhs + rhs_count * stride;
+    while (lhs < lhs_end && rhs < rhs_end) {
+        if (self->data.compare(x__vec_data(self, (void *)rhs), x__vec_data(self, (void *)lhs),
+                               context) < 0) {
+            memcpy(dest, rhs, stride);
+            rhs += stride;
+        }
+        else {
+            memcpy(dest, lhs, stride);
+            lhs += stride;
+        }
+        dest += stride;
+    }
+    memcpy(dest, lhs, lhs_end - lhs);
+    memcpy(dest + (lhs_end - lhs), rhs, rhs_end - rhs);
+}
+
+/**
+ * @brief Sort the items of a vector
+ * @param self Pointer to a vector
+ * @param context Pointer to a user-provided context for the comparison function (optional)
+ * @note This function requires a data comparison function to be set
+ * @note The sort is stable; it uses a temporary buffer of the size of the item array at the end of
+ * the arena, which is released when the function returns
+ */
+static void vec_sort(Vec *self, void *context) {
+    assert(self->data.compare);
+    long stride = x__vec_stride(self);
+    for (long begin = 0; begin < self->length; begin += vec_run) {
+        long count = self->length - begin < vec_run ? self->length - begin : vec_run;
+        x__vec_insertion_sort(self, x__vec_slot(self, begin), count, context);
+    }
+    if (self->length <= vec_run) {
+        return;
+    }
+    Arena scratch = *self->arena;
+    char *source = x__vec_slot(self, 0);
+    char *buffer = arena_malloc(&scratch, self->length, stride, alignof(max_align_t));
+    for (long width = vec_run; width < self->length; width *= 2) {
+        for (long begin = 0; begin < self->length; begin += 2 * width) {
+            long lhs_count = self->length - begin < width ? self->length - begin : width;
+            long rhs_count = self->length - begin - lhs_count < width
+                                 ? self->length - begin - lhs_count
+                                 : width;
+            x__vec_merge(self, buffer + begin * stride, source + begin * stride, lhs_count,
+                         source + (begin + lhs_count) * stride, rhs_count, context);
+        }
+        auto swap = source;
+        source = buffer;
+        buffer = swap;
+    }
+    if (source != x__vec_slot(self, 0)) {
+        memcpy(x__vec_slot(self, 0), source, self->length * stride);
+    }
+}
+
+/**
+ * @brief Create a clone of a vector
+ * @param self Pointer to a vector
+ * @param arena Pointer to an arena allocator (optional)
+ * @return Cloned vector instance
+ * @note If no arena allocator is passed, the arena allocator of the vector is used
+ */
+static Vec vec_clone(const Vec *self, Arena *arena) {
+    Vec vec = {};
+    vec.arena = arena ? arena : self->arena;
+    vec.data = self->data;
+    vec_reserve(&vec, self->length);
+    if (!self->data.size || self->data.copy == arena_memcpy) {
+        if (self->length) {
+            memcpy(x__vec_slot(&vec, 0), x__vec_slot(self, 0), self->length * x__vec_stride(self));
+        }
+    }
+    else {
+        for (long i = 0; i < self->length; i++) {
+            x__vec_item_init(&vec, x__vec_slot(&vec, i), x__vec_slot(self, i));
+        }
+    }
+    vec.length = self->length;
+    return vec;
+}